@@ -18,9 +18,11 @@
 // C++ headers
 #include <cstddef>  // size_t
 #include <cstring>  // memset()
+#include <type_traits>  // is_trivial
 #include <utility>  // swap()
 
 // Athena++ headers
+#include "utils/memory_pool.hpp"
 
 template <typename T>
 class AthenaArray {
@@ -29,28 +31,29 @@ class AthenaArray {
   // ctors
   // default ctor: simply set null AthenaArray
   AthenaArray() : pdata_(nullptr), nx1_(0), nx2_(0), nx3_(0),
-                  nx4_(0), nx5_(0), nx6_(0), state_(DataStatus::empty) {}
+                  nx4_(0), nx5_(0), nx6_(0), stride1_(0), state_(DataStatus::empty),
+                  pooled_(false) {}
   // ctor overloads: set expected size of unallocated container, maybe allocate (default)
   explicit AthenaArray(int nx1, DataStatus init=DataStatus::allocated) :
       pdata_(nullptr), nx1_(nx1), nx2_(1), nx3_(1), nx4_(1), nx5_(1), nx6_(1),
-      state_(init) { AllocateData(); }
+      stride1_(nx1), state_(init), pooled_(false) { AllocateData(); }
   AthenaArray(int nx2, int nx1, DataStatus init=DataStatus::allocated) :
       pdata_(nullptr), nx1_(nx1), nx2_(nx2), nx3_(1), nx4_(1), nx5_(1), nx6_(1),
-      state_(init) { AllocateData(); }
+      stride1_(nx1), state_(init), pooled_(false) { AllocateData(); }
   AthenaArray(int nx3, int nx2, int nx1, DataStatus init=DataStatus::allocated) :
       pdata_(nullptr), nx1_(nx1), nx2_(nx2), nx3_(nx3), nx4_(1), nx5_(1), nx6_(1),
-      state_(init) { AllocateData(); }
+      stride1_(nx1), state_(init), pooled_(false) { AllocateData(); }
   AthenaArray(int nx4, int nx3, int nx2, int nx1, DataStatus init=DataStatus::allocated) :
       pdata_(nullptr), nx1_(nx1), nx2_(nx2), nx3_(nx3), nx4_(nx4), nx5_(1), nx6_(1),
-      state_(init) { AllocateData(); }
+      stride1_(nx1), state_(init), pooled_(false) { AllocateData(); }
   AthenaArray(int nx5, int nx4, int nx3, int nx2, int nx1,
               DataStatus init=DataStatus::allocated) :
       pdata_(nullptr), nx1_(nx1), nx2_(nx2), nx3_(nx3), nx4_(nx4), nx5_(nx5),  nx6_(1),
-      state_(init) { AllocateData(); }
+      stride1_(nx1), state_(init), pooled_(false) { AllocateData(); }
   AthenaArray(int nx6, int nx5, int nx4, int nx3, int nx2, int nx1,
               DataStatus init=DataStatus::allocated) :
       pdata_(nullptr), nx1_(nx1), nx2_(nx2), nx3_(nx3), nx4_(nx4), nx5_(nx5), nx6_(nx6),
-      state_(init) { AllocateData(); }
+      stride1_(nx1), state_(init), pooled_(false) { AllocateData(); }
   // still allowing delayed-initialization (after constructor) via array.NewAthenaArray()
   // or array.InitWithShallowSlice() (only used in outputs.cpp + 3x other files)
   //! \todo (felker):
@@ -75,6 +78,13 @@ class AthenaArray {
                                                int nx1);
   __attribute__((nothrow)) void NewAthenaArray(int nx6, int nx5, int nx4, int nx3,
                                                int nx2, int nx1);
+  // allocate with the rows padded to whole cache lines and aligned to a cache line, for
+  // trivial types (otherwise the same as NewAthenaArray). Only for arrays that are
+  // accessed with operator() alone, see GetStride1().
+  __attribute__((nothrow)) void NewPaddedAthenaArray(int nx1);
+  __attribute__((nothrow)) void NewPaddedAthenaArray(int nx2, int nx1);
+  __attribute__((nothrow)) void NewPaddedAthenaArray(int nx3, int nx2, int nx1);
+  __attribute__((nothrow)) void NewPaddedAthenaArray(int nx4, int nx3, int nx2, int nx1);
   void DeleteAthenaArray();
 
   // public function to swap underlying data pointers of two equally-sized arrays
@@ -90,19 +100,22 @@ class AthenaArray {
   int GetDim4() const { return nx4_; }
   int GetDim5() const { return nx5_; }
   int GetDim6() const { return nx6_; }
+  // distance in elements between A(...,j,0) and A(...,j+1,0); equal to GetDim1() unless
+  // the array was allocated by NewPaddedAthenaArray
+  int GetStride1() const { return stride1_; }
 
-  // a function to get the total size of the array
+  // a function to get the total size of the array (including the padding of the rows)
   int GetSize() const {
     if (state_ == DataStatus::empty)
       return 0;
     else
-      return nx1_*nx2_*nx3_*nx4_*nx5_*nx6_;
+      return stride1_*nx2_*nx3_*nx4_*nx5_*nx6_;
   }
   std::size_t GetSizeInBytes() const {
     if (state_ == DataStatus::empty)
       return 0;
     else
-      return nx1_*nx2_*nx3_*nx4_*nx5_*nx6_*sizeof(T);
+      return stride1_*nx2_*nx3_*nx4_*nx5_*nx6_*sizeof(T);
   }
 
   bool IsShallowSlice() { return (state_ == DataStatus::shallow_slice); }
@@ -128,32 +141,32 @@ class AthenaArray {
     return pdata_[n]; }
 
   T &operator() (const int n, const int i) {
-    return pdata_[i + nx1_*n]; }
+    return pdata_[i + stride1_*n]; }
   T operator() (const int n, const int i) const {
-    return pdata_[i + nx1_*n]; }
+    return pdata_[i + stride1_*n]; }
 
   T &operator() (const int n, const int j, const int i) {
-    return pdata_[i + nx1_*(j + nx2_*n)]; }
+    return pdata_[i + stride1_*(j + nx2_*n)]; }
   T operator() (const int n, const int j, const int i) const {
-    return pdata_[i + nx1_*(j + nx2_*n)]; }
+    return pdata_[i + stride1_*(j + nx2_*n)]; }
 
   T &operator() (const int n, const int k, const int j, const int i) {
-    return pdata_[i + nx1_*(j + nx2_*(k + nx3_*n))]; }
+    return pdata_[i + stride1_*(j + nx2_*(k + nx3_*n))]; }
   T operator() (const int n, const int k, const int j, const int i) const {
-    return pdata_[i + nx1_*(j + nx2_*(k + nx3_*n))]; }
+    return pdata_[i + stride1_*(j + nx2_*(k + nx3_*n))]; }
 
   T &operator() (const int m, const int n, const int k, const int j, const int i) {
-    return pdata_[i + nx1_*(j + nx2_*(k + nx3_*(n + nx4_*m)))]; }
+    return pdata_[i + stride1_*(j + nx2_*(k + nx3_*(n + nx4_*m)))]; }
   T operator() (const int m, const int n, const int k, const int j, const int i) const {
-    return pdata_[i + nx1_*(j + nx2_*(k + nx3_*(n + nx4_*m)))]; }
+    return pdata_[i + stride1_*(j + nx2_*(k + nx3_*(n + nx4_*m)))]; }
 
   // int l?, int o?
   T &operator() (const int p, const int m, const int n, const int k, const int j,
                  const int i) {
-    return pdata_[i + nx1_*(j + nx2_*(k + nx3_*(n + nx4_*(m + nx5_*p))))]; }
+    return pdata_[i + stride1_*(j + nx2_*(k + nx3_*(n + nx4_*(m + nx5_*p))))]; }
   T operator() (const int p, const int m, const int n, const int k, const int j,
                 const int i) const {
-    return pdata_[i + nx1_*(j + nx2_*(k + nx3_*(n + nx4_*(m + nx5_*p))))]; }
+    return pdata_[i + stride1_*(j + nx2_*(k + nx3_*(n + nx4_*(m + nx5_*p))))]; }
 
   // (deferred) initialize an array with slice from another array
   void InitWithShallowSlice(AthenaArray<T> &src, const int dim, const int indx,
@@ -165,9 +178,12 @@ class AthenaArray {
  private:
   T *pdata_;
   int nx1_, nx2_, nx3_, nx4_, nx5_, nx6_;
+  int stride1_;       // distance between consecutive rows; > nx1_ if padded
   DataStatus state_;  // describe what "pdata_" points to and ownership of allocated data
+  bool pooled_;       // the allocated data is owned by the MemoryPool
 
   void AllocateData();
+  void AllocatePaddedData();
 };
 
 
@@ -182,19 +198,23 @@ AthenaArray<T>::~AthenaArray() {
 
 template<typename T>
 __attribute__((nothrow)) AthenaArray<T>::AthenaArray(const AthenaArray<T>& src) {
+  pdata_ = nullptr;
+  state_ = DataStatus::empty;
   nx1_ = src.nx1_;
   nx2_ = src.nx2_;
   nx3_ = src.nx3_;
   nx4_ = src.nx4_;
   nx5_ = src.nx5_;
   nx6_ = src.nx6_;
+  stride1_ = src.stride1_;
+  pooled_ = false;
   if (src.pdata_) {
-    std::size_t size = (src.nx1_)*(src.nx2_)*(src.nx3_)*(src.nx4_)*(src.nx5_);
-    pdata_ = new T[size]; // allocate memory for array data
+    std::size_t size = (src.stride1_)*(src.nx2_)*(src.nx3_)*(src.nx4_)*(src.nx5_);
+    state_ = DataStatus::allocated;
+    AllocateData(); // allocate memory for array data
     for (std::size_t i=0; i<size; ++i) {
       pdata_[i] = src.pdata_[i]; // copy data (not just addresses!) into new memory
     }
-    state_ = DataStatus::allocated;
   }
 }
 
@@ -212,7 +232,9 @@ AthenaArray<T> &AthenaArray<T>::operator= (const AthenaArray<T> &src) {
     nx4_ = src.nx4_;
     nx5_ = src.nx5_;
     nx6_ = src.nx6_;
-    std::size_t size = (src.nx1_)*(src.nx2_)*(src.nx3_)*(src.nx4_)*(src.nx5_)*(src.nx6_);
+    stride1_ = src.stride1_;
+    std::size_t size = (src.stride1_)*(src.nx2_)*(src.nx3_)*(src.nx4_)*(src.nx5_)
+                       *(src.nx6_);
     for (std::size_t i=0; i<size; ++i) {
       this->pdata_[i] = src.pdata_[i]; // copy data (not just addresses!)
     }
@@ -224,12 +246,16 @@ AthenaArray<T> &AthenaArray<T>::operator= (const AthenaArray<T> &src) {
 // move constructor
 template<typename T>
 __attribute__((nothrow)) AthenaArray<T>::AthenaArray(AthenaArray<T>&& src) {
+  pdata_ = nullptr;
+  state_ = DataStatus::empty;
+  pooled_ = false;
   nx1_ = src.nx1_;
   nx2_ = src.nx2_;
   nx3_ = src.nx3_;
   nx4_ = src.nx4_;
   nx5_ = src.nx5_;
   nx6_ = src.nx6_;
+  stride1_ = src.stride1_;
   if (src.pdata_) {
     // && (src.state_ != DataStatus::allocated){  // (if forbidden to move shallow slices)
     //  ---- >state_ = DataStatus::allocated;
@@ -237,15 +263,18 @@ __attribute__((nothrow)) AthenaArray<T>::AthenaArray(AthenaArray<T>&& src) {
     // Allowing src shallow-sliced AthenaArray to serve as move constructor argument
     state_ = src.state_;
     pdata_ = src.pdata_;
+    pooled_ = src.pooled_;
     // remove ownership of data from src to prevent it from free'ing the resources
     src.pdata_ = nullptr;
     src.state_ = DataStatus::empty;
+    src.pooled_ = false;
     src.nx1_ = 0;
     src.nx2_ = 0;
     src.nx3_ = 0;
     src.nx4_ = 0;
     src.nx5_ = 0;
     src.nx6_ = 0;
+    src.stride1_ = 0;
   }
 }
 
@@ -263,17 +292,21 @@ AthenaArray<T> &AthenaArray<T>::operator= (AthenaArray<T> &&src) {
       nx4_ = src.nx4_;
       nx5_ = src.nx5_;
       nx6_ = src.nx6_;
+      stride1_ = src.stride1_;
       state_ = src.state_;
       pdata_ = src.pdata_;
+      pooled_ = src.pooled_;
 
       src.pdata_ = nullptr;
       src.state_ = DataStatus::empty;
+      src.pooled_ = false;
       src.nx1_ = 0;
       src.nx2_ = 0;
       src.nx3_ = 0;
       src.nx4_ = 0;
       src.nx5_ = 0;
       src.nx6_ = 0;
+      src.stride1_ = 0;
     }
   }
   return *this;
@@ -292,6 +325,7 @@ template<typename T>
 void AthenaArray<T>::InitWithShallowSlice(AthenaArray<T> &src, const int dim,
                                           const int indx, const int nvar) {
   pdata_ = src.pdata_;
+  stride1_ = src.stride1_;
   if (dim == 6) {
     nx6_ = nvar;
     nx5_ = src.nx5_;
@@ -299,7 +333,7 @@ void AthenaArray<T>::InitWithShallowSlice(AthenaArray<T> &src, const int dim,
     nx3_ = src.nx3_;
     nx2_ = src.nx2_;
     nx1_ = src.nx1_;
-    pdata_ += indx*(nx1_*nx2_*nx3_*nx4_*nx5_);
+    pdata_ += indx*(stride1_*nx2_*nx3_*nx4_*nx5_);
   } else if (dim == 5) {
     nx6_ = 1;
     nx5_ = nvar;
@@ -307,7 +341,7 @@ void AthenaArray<T>::InitWithShallowSlice(AthenaArray<T> &src, const int dim,
     nx3_ = src.nx3_;
     nx2_ = src.nx2_;
     nx1_ = src.nx1_;
-    pdata_ += indx*(nx1_*nx2_*nx3_*nx4_);
+    pdata_ += indx*(stride1_*nx2_*nx3_*nx4_);
   } else if (dim == 4) {
     nx6_ = 1;
     nx5_ = 1;
@@ -315,7 +349,7 @@ void AthenaArray<T>::InitWithShallowSlice(AthenaArray<T> &src, const int dim,
     nx3_ = src.nx3_;
     nx2_ = src.nx2_;
     nx1_ = src.nx1_;
-    pdata_ += indx*(nx1_*nx2_*nx3_);
+    pdata_ += indx*(stride1_*nx2_*nx3_);
   } else if (dim == 3) {
     nx6_ = 1;
     nx5_ = 1;
@@ -323,7 +357,7 @@ void AthenaArray<T>::InitWithShallowSlice(AthenaArray<T> &src, const int dim,
     nx3_ = nvar;
     nx2_ = src.nx2_;
     nx1_ = src.nx1_;
-    pdata_ += indx*(nx1_*nx2_);
+    pdata_ += indx*(stride1_*nx2_);
   } else if (dim == 2) {
     nx6_ = 1;
     nx5_ = 1;
@@ -331,7 +365,7 @@ void AthenaArray<T>::InitWithShallowSlice(AthenaArray<T> &src, const int dim,
     nx3_ = 1;
     nx2_ = nvar;
     nx1_ = src.nx1_;
-    pdata_ += indx*(nx1_);
+    pdata_ += indx*(stride1_);
   } else if (dim == 1) {
     nx6_ = 1;
     nx5_ = 1;
@@ -339,6 +373,7 @@ void AthenaArray<T>::InitWithShallowSlice(AthenaArray<T> &src, const int dim,
     nx3_ = 1;
     nx2_ = 1;
     nx1_ = nvar;
+    stride1_ = nvar;
     pdata_ += indx;
   }
   state_ = DataStatus::shallow_slice;
@@ -353,12 +388,13 @@ template<typename T>
 __attribute__((nothrow)) void AthenaArray<T>::NewAthenaArray(int nx1) {
   state_ = DataStatus::allocated;
   nx1_ = nx1;
+  stride1_ = nx1;
   nx2_ = 1;
   nx3_ = 1;
   nx4_ = 1;
   nx5_ = 1;
   nx6_ = 1;
-  pdata_ = new T[nx1](); // allocate memory and initialize to zero
+  AllocateData(); // allocate memory and initialize to zero
 }
 
 //----------------------------------------------------------------------------------------
@@ -369,12 +405,13 @@ template<typename T>
 __attribute__((nothrow)) void AthenaArray<T>::NewAthenaArray(int nx2, int nx1) {
   state_ = DataStatus::allocated;
   nx1_ = nx1;
+  stride1_ = nx1;
   nx2_ = nx2;
   nx3_ = 1;
   nx4_ = 1;
   nx5_ = 1;
   nx6_ = 1;
-  pdata_ = new T[nx1*nx2](); // allocate memory and initialize to zero
+  AllocateData(); // allocate memory and initialize to zero
 }
 
 //----------------------------------------------------------------------------------------
@@ -385,12 +422,13 @@ template<typename T>
 __attribute__((nothrow)) void AthenaArray<T>::NewAthenaArray(int nx3, int nx2, int nx1) {
   state_ = DataStatus::allocated;
   nx1_ = nx1;
+  stride1_ = nx1;
   nx2_ = nx2;
   nx3_ = nx3;
   nx4_ = 1;
   nx5_ = 1;
   nx6_ = 1;
-  pdata_ = new T[nx1*nx2*nx3](); // allocate memory and initialize to zero
+  AllocateData(); // allocate memory and initialize to zero
 }
 
 //----------------------------------------------------------------------------------------
@@ -402,12 +440,13 @@ __attribute__((nothrow)) void AthenaArray<T>::NewAthenaArray(int nx4, int nx3, i
                                                              int nx1) {
   state_ = DataStatus::allocated;
   nx1_ = nx1;
+  stride1_ = nx1;
   nx2_ = nx2;
   nx3_ = nx3;
   nx4_ = nx4;
   nx5_ = 1;
   nx6_ = 1;
-  pdata_ = new T[nx1*nx2*nx3*nx4](); // allocate memory and initialize to zero
+  AllocateData(); // allocate memory and initialize to zero
 }
 
 //----------------------------------------------------------------------------------------
@@ -419,12 +458,13 @@ __attribute__((nothrow)) void AthenaArray<T>::NewAthenaArray(int nx5, int nx4, i
                                                              int nx2, int nx1) {
   state_ = DataStatus::allocated;
   nx1_ = nx1;
+  stride1_ = nx1;
   nx2_ = nx2;
   nx3_ = nx3;
   nx4_ = nx4;
   nx5_ = nx5;
   nx6_ = 1;
-  pdata_ = new T[nx1*nx2*nx3*nx4*nx5](); // allocate memory and initialize to zero
+  AllocateData(); // allocate memory and initialize to zero
 }
 
 //----------------------------------------------------------------------------------------
@@ -436,12 +476,58 @@ __attribute__((nothrow)) void AthenaArray<T>::NewAthenaArray(int nx6, int nx5, i
                                                              int nx3, int nx2, int nx1) {
   state_ = DataStatus::allocated;
   nx1_ = nx1;
+  stride1_ = nx1;
   nx2_ = nx2;
   nx3_ = nx3;
   nx4_ = nx4;
   nx5_ = nx5;
   nx6_ = nx6;
-  pdata_ = new T[nx1*nx2*nx3*nx4*nx5*nx6](); // allocate memory and initialize to zero
+  AllocateData(); // allocate memory and initialize to zero
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn AthenaArray::NewPaddedAthenaArray()
+//! \brief 1d data allocation aligned to a cache line
+
+template<typename T>
+__attribute__((nothrow)) void AthenaArray<T>::NewPaddedAthenaArray(int nx1) {
+  NewPaddedAthenaArray(1, 1, 1, nx1);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn AthenaArray::NewPaddedAthenaArray()
+//! \brief 2d data allocation with padded rows
+
+template<typename T>
+__attribute__((nothrow)) void AthenaArray<T>::NewPaddedAthenaArray(int nx2, int nx1) {
+  NewPaddedAthenaArray(1, 1, nx2, nx1);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn AthenaArray::NewPaddedAthenaArray()
+//! \brief 3d data allocation with padded rows
+
+template<typename T>
+__attribute__((nothrow)) void AthenaArray<T>::NewPaddedAthenaArray(int nx3, int nx2,
+                                                                   int nx1) {
+  NewPaddedAthenaArray(1, nx3, nx2, nx1);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn AthenaArray::NewPaddedAthenaArray()
+//! \brief 4d data allocation with padded rows
+
+template<typename T>
+__attribute__((nothrow)) void AthenaArray<T>::NewPaddedAthenaArray(int nx4, int nx3,
+                                                                   int nx2, int nx1) {
+  state_ = DataStatus::allocated;
+  nx1_ = nx1;
+  nx2_ = nx2;
+  nx3_ = nx3;
+  nx4_ = nx4;
+  nx5_ = 1;
+  nx6_ = 1;
+  AllocatePaddedData();
 }
 
 //----------------------------------------------------------------------------------------
@@ -457,8 +543,12 @@ void AthenaArray<T>::DeleteAthenaArray() {
       pdata_ = nullptr;
       break;
     case DataStatus::allocated:
-      delete[] pdata_;
+      if (pooled_)
+        MemoryPool::Free(pdata_);
+      else
+        delete[] pdata_;
       pdata_ = nullptr;
+      pooled_ = false;
       state_ = DataStatus::empty;
       break;
   }
@@ -476,6 +566,7 @@ void AthenaArray<T>::DeleteAthenaArray() {
 template<typename T>
 void AthenaArray<T>::SwapAthenaArray(AthenaArray<T>& array2) {
   std::swap(pdata_, array2.pdata_);
+  std::swap(pooled_, array2.pooled_);
   return;
 }
 
@@ -496,8 +587,10 @@ void AthenaArray<T>::ExchangeAthenaArray(AthenaArray<T>& array2) {
   std::swap(nx4_, array2.nx4_);
   std::swap(nx5_, array2.nx5_);
   std::swap(nx6_, array2.nx6_);
+  std::swap(stride1_, array2.stride1_);
   std::swap(state_, array2.state_);
   std::swap(pdata_, array2.pdata_);
+  std::swap(pooled_, array2.pooled_);
   return;
 }
 
@@ -521,8 +614,10 @@ void AthenaArray<T>::ZeroClear() {
 
 //----------------------------------------------------------------------------------------
 //! \fn AthenaArray::AllocateData()
-//! \brief  to be called in non-default ctors, if immediate memory allocation is requested
-//!         (could replace all "new[]" calls in NewAthenaArray function overloads)
+//! \brief  to be called in non-default ctors (if immediate memory allocation is
+//!         requested) and in the NewAthenaArray function overloads
+//!
+//! The data of arrays of trivial types is drawn from the MemoryPool if it is enabled.
 
 template<typename T>
 void AthenaArray<T>::AllocateData() {
@@ -532,10 +627,35 @@ void AthenaArray<T>::AllocateData() {
       break;
     case DataStatus::allocated:
       // allocate memory and initialize to zero
-      pdata_ = new T[nx1_*nx2_*nx3_*nx4_*nx5_*nx6_]();
+      pooled_ = std::is_trivial<T>::value && MemoryPool::IsEnabled();
+      if (pooled_)
+        pdata_ = static_cast<T*>(MemoryPool::Allocate(sizeof(T)*stride1_*nx2_*nx3_*nx4_
+                                                      *nx5_*nx6_));
+      else
+        pdata_ = new T[stride1_*nx2_*nx3_*nx4_*nx5_*nx6_]();
       break;
   }
 }
+//----------------------------------------------------------------------------------------
+//! \fn AthenaArray::AllocatePaddedData()
+//! \brief  round the rows up to a multiple of MemoryPool::alignment bytes (a multiple of
+//!         SIMD_WIDTH elements) and draw the data from the MemoryPool, which aligns it
+
+template<typename T>
+void AthenaArray<T>::AllocatePaddedData() {
+  const int nalign = MemoryPool::alignment/sizeof(T);
+  if (!std::is_trivial<T>::value || nalign*sizeof(T) != MemoryPool::alignment) {
+    // no whole number of elements per cache line
+    stride1_ = nx1_;
+    AllocateData();
+    return;
+  }
+  stride1_ = ((nx1_ + nalign - 1)/nalign)*nalign;
+  pooled_ = true;
+  pdata_ = static_cast<T*>(MemoryPool::Allocate(sizeof(T)*stride1_*nx2_*nx3_*nx4_*nx5_
+                                                *nx6_));
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn AthenaArray<T>::ShallowSlice3DToPencil(AthenaArray<T> &src, const int k,
 //                                             const int j, const int il, const int n) {
@@ -552,7 +672,8 @@ void AthenaArray<T>::ShallowSlice3DToPencil(AthenaArray<T> &src, const int k,
   nx3_ = 1;
   nx2_ = 1;
   nx1_ = n;
-  pdata_ += (k*src.nx2_+j)*src.nx1_+il;
+  stride1_ = n;
+  pdata_ += (k*src.nx2_+j)*src.stride1_+il;
   state_ = DataStatus::shallow_slice;
   return;
 }
@@ -40,6 +40,7 @@
 #include "../scalars/scalars.hpp"
 #include "../utils/buffer_utils.hpp"
 #include "bvals.hpp"
+#include "bvals_coalesced.hpp"
 
 // MPI header
 #ifdef MPI_PARALLEL
@@ -345,10 +346,19 @@ void BoundaryValues::CheckUserBoundaries() {
 
 void BoundaryValues::StartReceivingSubset(BoundaryCommSubset phase,
                                           std::vector<BoundaryVariable *> bvars_subset) {
+#ifdef MPI_PARALLEL
+  // only the main integrator stages exchange the coalesced messages
+  coalesce_mpi_ = (pmy_mesh_->pcbcomm != nullptr && phase == BoundaryCommSubset::all
+                   && bvars_subset == bvars_main_int);
+#endif
   for (auto bvars_it = bvars_subset.begin(); bvars_it != bvars_subset.end();
        ++bvars_it) {
     (*bvars_it)->StartReceiving(phase);
   }
+#ifdef MPI_PARALLEL
+  if (coalesce_mpi_)
+    pmy_mesh_->pcbcomm->StartReceiving();
+#endif
 
   // KGF: begin shearing-box exclusive section of original StartReceivingForInit()
   // find send_block_id and recv_block_id;
@@ -421,6 +431,7 @@ void BoundaryValues::ClearBoundarySubset(BoundaryCommSubset phase,
        ++bvars_it) {
     (*bvars_it)->ClearBoundary(phase);
   }
+  coalesce_mpi_ = false;
   return;
 }
 
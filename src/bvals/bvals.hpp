@@ -169,6 +169,10 @@ class BoundaryValues : public BoundaryBase, //public BoundaryPhysics,
   //! communication (subset of Mesh::next_phys_id_)
   int bvars_next_phys_id_;
 
+  //! if the messages of bvars_main_int to other ranks go through Mesh::pcbcomm in the
+  //! current stage (set in StartReceivingSubset(), cleared in ClearBoundarySubset())
+  bool coalesce_mpi_{};
+
   // Shearing box (shared with Field and Hydro)
   // KGF: remove the redundancies in these variables:
   int shearing_box; // flag for shearing box: 0 = none, 1: xy, 2: xz
@@ -0,0 +1,285 @@
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file bvals_coalesced.cpp
+//! \brief implementation of the CoalescedBoundaryComm class
+
+// C headers
+
+// C++ headers
+#include <algorithm>  // std::sort
+#include <cstring>    // std::memcpy
+#include <iostream>   // endl
+#include <sstream>    // stringstream
+#include <stdexcept>  // runtime_error
+#include <vector>     // std::vector
+
+// Athena++ headers
+#include "../athena.hpp"
+#include "../mesh/mesh.hpp"
+#include "bvals_coalesced.hpp"
+
+#ifdef MPI_PARALLEL
+
+//----------------------------------------------------------------------------------------
+//! CoalescedBoundaryComm constructor
+
+CoalescedBoundaryComm::CoalescedBoundaryComm(Mesh *pm, bool single_precision) :
+    pmy_mesh_(pm), nstarted_(), single_precision_(single_precision) {
+  if (pm->shear_periodic || STS_ENABLED) {
+    std::stringstream msg;
+    msg << "### FATAL ERROR in CoalescedBoundaryComm constructor" << std::endl
+        << "<mesh>/coalesce_boundary_mpi = true does not support shear_periodic "
+        << "boundaries or super-time-stepping." << std::endl;
+    ATHENA_ERROR(msg);
+  }
+  // a separate communicator, so that the message tags are simply the channels
+  MPI_Comm_dup(MPI_COMM_WORLD, &comm_);
+#ifdef OPENMP_PARALLEL
+  omp_init_lock(&lock_);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! CoalescedBoundaryComm destructor
+
+CoalescedBoundaryComm::~CoalescedBoundaryComm() {
+  WaitSends();
+  MPI_Comm_free(&comm_);
+#ifdef OPENMP_PARALLEL
+  omp_destroy_lock(&lock_);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::Lock()
+//! \brief Lock the messages for modification
+
+void CoalescedBoundaryComm::Lock() {
+#ifdef OPENMP_PARALLEL
+  omp_set_lock(&lock_);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::Unlock()
+//! \brief Unlock the messages
+
+void CoalescedBoundaryComm::Unlock() {
+#ifdef OPENMP_PARALLEL
+  omp_unset_lock(&lock_);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::WaitSends()
+//! \brief wait until the messages sent in the previous stage have left the send buffers
+
+void CoalescedBoundaryComm::WaitSends() {
+  for (auto &m : send_msg_) {
+    if (m.req != MPI_REQUEST_NULL)
+      MPI_Wait(&m.req, MPI_STATUS_IGNORE);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::ClearParts()
+//! \brief drop all messages before the persistent MPI requests are set up again
+
+void CoalescedBoundaryComm::ClearParts() {
+  WaitSends();
+  send_part_.clear();
+  recv_part_.clear();
+  send_msg_.clear();
+  recv_msg_.clear();
+  nstarted_ = 0;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::AddSendPart(int gid, int bvar, bool flcor,
+//!                                   int bufid, int rank, int size, int *pid)
+//! \brief register send buffer bufid of BoundaryVariable bvar of MeshBlock gid.
+//! Its index is stored in *pid by BuildMessages().
+
+void CoalescedBoundaryComm::AddSendPart(int gid, int bvar, bool flcor, int bufid,
+                                        int rank, int size, int *pid) {
+  Part p{gid, bvar, bufid, flcor ? 0 : 1, rank, size, pid, nullptr, nullptr, nullptr,
+         -1, 0};
+  Lock();
+  send_part_.push_back(p);
+  Unlock();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::AddRecvPart(int gid, int bvar, bool flcor,
+//!                   int bufid, int rank, int size, int *pid, Real *buf,
+//!                   BoundaryStatus *pflag, MeshBlock *pmb)
+//! \brief register the receive buffer buf (with flag *pflag) of MeshBlock pmb for the
+//! data sent from buffer bufid of BoundaryVariable bvar of MeshBlock gid
+
+void CoalescedBoundaryComm::AddRecvPart(int gid, int bvar, bool flcor, int bufid,
+                                        int rank, int size, int *pid, Real *buf,
+                                        BoundaryStatus *pflag, MeshBlock *pmb) {
+  Part p{gid, bvar, bufid, flcor ? 0 : 1, rank, size, pid, buf, pflag, pmb, -1, 0};
+  Lock();
+  recv_part_.push_back(p);
+  Unlock();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::SortAndGroup(std::vector<Part> &parts,
+//!                                               std::vector<Message> &msgs)
+//! \brief order the parts identically on the sending and receiving ranks and group them
+//! into one message per channel and rank
+
+void CoalescedBoundaryComm::SortAndGroup(std::vector<Part> &parts,
+                                         std::vector<Message> &msgs) {
+  std::sort(parts.begin(), parts.end(), [](const Part &a, const Part &b) {
+    if (a.channel != b.channel) return a.channel < b.channel;
+    if (a.rank != b.rank) return a.rank < b.rank;
+    if (a.gid != b.gid) return a.gid < b.gid;
+    if (a.bvar != b.bvar) return a.bvar < b.bvar;
+    return a.bufid < b.bufid;
+  });
+  for (int n=0; n<static_cast<int>(parts.size()); ++n) {
+    Part &p = parts[n];
+    if (msgs.empty() || msgs.back().channel != p.channel
+        || msgs.back().rank != p.rank) {
+      Message m;
+      m.channel = p.channel;
+      m.rank = p.rank;
+      m.size = 0;
+      m.npart = 0;
+      m.npacked = 0;
+      m.first = n;
+      m.arrived = false;
+      m.single = single_precision_ && p.channel == 1;
+      m.req = MPI_REQUEST_NULL;
+      msgs.push_back(m);
+    }
+    Message &m = msgs.back();
+    p.msg = static_cast<int>(msgs.size()) - 1;
+    p.offset = m.size;
+    m.size += p.size;
+    m.npart++;
+    *p.pid = n;
+  }
+  for (auto &m : msgs) {
+    m.data.resize(m.size);
+    if (m.single) m.wire.resize(m.size);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::BuildMessages()
+//! \brief compute the layout of the messages once all MeshBlocks have registered
+
+void CoalescedBoundaryComm::BuildMessages() {
+  SortAndGroup(send_part_, send_msg_);
+  SortAndGroup(recv_part_, recv_msg_);
+  for (auto &p : send_part_)
+    p.buf = send_msg_[p.msg].data.data() + p.offset;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::StartReceiving()
+//! \brief called by every MeshBlock in BoundaryValues::StartReceivingSubset(). The first
+//! call of a stage posts the receives; all MeshBlocks call it before any task runs.
+
+void CoalescedBoundaryComm::StartReceiving() {
+  Lock();
+  if (nstarted_ == 0) {
+    // the send buffers are packed again in this stage
+    WaitSends();
+    for (auto &m : send_msg_)
+      m.npacked = 0;
+    for (auto &m : recv_msg_) {
+      m.arrived = false;
+      if (m.single)
+        MPI_Irecv(m.wire.data(), m.size, MPI_FLOAT, m.rank, m.channel, comm_, &m.req);
+      else
+        MPI_Irecv(m.data.data(), m.size, MPI_ATHENA_REAL, m.rank, m.channel, comm_,
+                  &m.req);
+    }
+  }
+  if (++nstarted_ == pmy_mesh_->nblocal) nstarted_ = 0;
+  Unlock();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void CoalescedBoundaryComm::Send(int id)
+//! \brief mark send part id as packed; the message is sent with its last part
+
+void CoalescedBoundaryComm::Send(int id) {
+  Lock();
+  Message &m = send_msg_[send_part_[id].msg];
+  if (++m.npacked == m.npart) {
+    if (m.single) {
+      const Real *data = m.data.data();
+      float *wire = m.wire.data();
+#pragma omp simd
+      for (int n=0; n<m.size; ++n)
+        wire[n] = static_cast<float>(data[n]);
+      MPI_Isend(wire, m.size, MPI_FLOAT, m.rank, m.channel, comm_, &m.req);
+    } else {
+      MPI_Isend(m.data.data(), m.size, MPI_ATHENA_REAL, m.rank, m.channel, comm_,
+                &m.req);
+    }
+  }
+  Unlock();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool CoalescedBoundaryComm::Test(int id)
+//! \brief test for the message containing receive part id. When it has arrived, all of
+//! its parts are copied to the target buffers and flagged as arrived.
+
+bool CoalescedBoundaryComm::Test(int id) {
+  Lock();
+  Message &m = recv_msg_[recv_part_[id].msg];
+  if (!m.arrived) {
+    int test, count;
+    MPI_Status status;
+    MPI_Test(&m.req, &test, &status);
+    if (static_cast<bool>(test)) {
+      MPI_Get_count(&status, m.single ? MPI_FLOAT : MPI_ATHENA_REAL, &count);
+      if (count != m.size) {
+        std::stringstream msg;
+        msg << "### FATAL ERROR in CoalescedBoundaryComm::Test" << std::endl
+            << "Received " << count << " values from rank " << m.rank
+            << " instead of " << m.size << "." << std::endl;
+        ATHENA_ERROR(msg);
+      }
+      for (int n=m.first; n<m.first+m.npart; ++n) {
+        Part &p = recv_part_[n];
+        if (m.single) {
+          const float *wire = m.wire.data() + p.offset;
+          for (int i=0; i<p.size; ++i)
+            p.buf[i] = static_cast<Real>(wire[i]);
+        } else {
+          std::memcpy(p.buf, m.data.data() + p.offset, p.size*sizeof(Real));
+        }
+        *p.pflag = BoundaryStatus::arrived;
+        p.pmb->NotifyBoundaryArrival();
+      }
+      m.arrived = true;
+    }
+  }
+  bool arrived = m.arrived;
+  Unlock();
+  return arrived;
+}
+
+#endif // MPI_PARALLEL
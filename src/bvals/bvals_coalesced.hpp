@@ -0,0 +1,111 @@
+#ifndef BVALS_BVALS_COALESCED_HPP_
+#define BVALS_BVALS_COALESCED_HPP_
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file bvals_coalesced.hpp
+//! \brief aggregation of the boundary messages exchanged between two MPI ranks
+
+// C headers
+
+// C++ headers
+#include <vector>     // std::vector
+
+// Athena++ headers
+#include "../athena.hpp"
+#include "bvals_interfaces.hpp"
+
+// MPI header
+#ifdef MPI_PARALLEL
+#include <mpi.h>
+#endif
+
+// OpenMP header
+#ifdef OPENMP_PARALLEL
+#include <omp.h>
+#endif
+
+#ifdef MPI_PARALLEL
+
+//----------------------------------------------------------------------------------------
+//! \class CoalescedBoundaryComm
+//! \brief packs all boundary buffers of BoundaryValues::bvars_main_int that one rank
+//! sends to another rank in an integrator stage into a single MPI message.
+//!
+//! Enabled with <mesh>/coalesce_boundary_mpi = true. There are two messages per pair of
+//! ranks and per stage: one for the flux corrections and one for the ghost zones of the
+//! variables (the latter depend on the former, never the other way around). Each part of
+//! a message is registered next to the persistent MPI request it replaces in
+//! SetupPersistentMPI(). The parts are sorted by (sending gid, bvar_index, sending bufid)
+//! on both sides, so that the sender and the receiver agree on the offsets without any
+//! extra communication. A message is sent when its last part has been packed. It is
+//! unpacked into the BoundaryData::recv buffers of the target MeshBlocks as soon as one
+//! of them tests for it, which also sets their BoundaryStatus flags to arrived.
+//!
+//! With <mesh>/single_precision_boundary_mpi = true, the ghost-zone messages are rounded
+//! to float for the transfer, which halves the bytes sent between the ranks. The flux
+//! corrections are always sent at full precision, so that conservation is unaffected.
+
+class CoalescedBoundaryComm {
+ public:
+  CoalescedBoundaryComm(Mesh *pm, bool single_precision);
+  ~CoalescedBoundaryComm();
+  CoalescedBoundaryComm(const CoalescedBoundaryComm&) = delete;
+  CoalescedBoundaryComm& operator=(const CoalescedBoundaryComm&) = delete;
+
+  // rebuilt around the calls to BoundaryValues::SetupPersistentMPI() in Mesh::Initialize
+  void ClearParts();
+  void AddSendPart(int gid, int bvar, bool flcor, int bufid, int rank, int size,
+                   int *pid);
+  void AddRecvPart(int gid, int bvar, bool flcor, int bufid, int rank, int size,
+                   int *pid, Real *buf, BoundaryStatus *pflag, MeshBlock *pmb);
+  void BuildMessages();
+
+  // called in the main integrator stages
+  void StartReceiving();
+  Real *SendBuffer(int id) { return send_part_[id].buf; }
+  void Send(int id);
+  bool Test(int id);
+
+ private:
+  //! one BoundaryData buffer inside a message
+  struct Part {
+    int gid, bvar, bufid;   // sending MeshBlock, BoundaryVariable and buffer
+    int channel, rank, size;
+    int *pid;               // BoundaryData::cid_send/cid_recv to set in BuildMessages()
+    Real *buf;              // send: position in the message, recv: target buffer
+    BoundaryStatus *pflag;  // recv only
+    MeshBlock *pmb;         // recv only, for NotifyBoundaryArrival()
+    int msg, offset;
+  };
+  //! one message to/from another rank
+  struct Message {
+    int channel, rank, size, npart, npacked;
+    int first;              // index of the first Part
+    bool arrived;
+    bool single;            // sent as float through wire
+    std::vector<Real> data;
+    std::vector<float> wire;
+    MPI_Request req;
+  };
+
+  Mesh *pmy_mesh_;
+  MPI_Comm comm_;
+  int nstarted_;            // number of MeshBlocks that started the current stage
+  bool single_precision_;   // send the ghost zones (channel 1) as float
+  std::vector<Part> send_part_, recv_part_;
+  std::vector<Message> send_msg_, recv_msg_;
+#ifdef OPENMP_PARALLEL
+  omp_lock_t lock_;
+#endif
+
+  void Lock();
+  void Unlock();
+  void WaitSends();
+  void SortAndGroup(std::vector<Part> &parts, std::vector<Message> &msgs);
+};
+
+#endif // MPI_PARALLEL
+#endif // BVALS_BVALS_COALESCED_HPP_
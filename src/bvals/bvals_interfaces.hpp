@@ -169,6 +169,8 @@ struct BoundaryData { // aggregate and POD (even when MPI_PARALLEL is defined)
   Real *send[kMaxNeighbor], *recv[kMaxNeighbor];
 #ifdef MPI_PARALLEL
   MPI_Request req_send[kMaxNeighbor], req_recv[kMaxNeighbor];
+  //! index of the buffer in Mesh::pcbcomm, or -1 if it has its own MPI request
+  int cid_send[kMaxNeighbor], cid_recv[kMaxNeighbor];
 #endif
 };
 
@@ -342,6 +344,14 @@ class BoundaryVariable : public BoundaryCommunication, public BoundaryBuffer,
   BoundaryValues *pbval_;  // ptr to BoundaryValues that aggregates these
                            // BoundaryVariable objects
 
+  Real *SendBufferPointer(NeighborBlock& nb, bool flcor);
+  // messages to other ranks: own persistent MPI requests or parts of Mesh::pcbcomm
+  void ClearCoalescedParts();
+  void CoalesceSend(NeighborBlock& nb, bool flcor, int size);
+  void CoalesceRecv(NeighborBlock& nb, bool flcor, int size);
+  void StartSend(BoundaryData<> &bd, int bufid);
+  void StartRecv(BoundaryData<> &bd, int bufid);
+  bool TestRecv(BoundaryData<> &bd, int bufid);
   void CopyVariableBufferSameProcess(NeighborBlock& nb, int ssize);
   void CopyFluxCorrectionBufferSameProcess(NeighborBlock& nb, int ssize);
 
@@ -11,6 +11,7 @@
 // C headers
 
 // C++ headers
+#include <algorithm>  // std::find
 #include <cstring>    // std::memcpy
 #include <iostream>   // endl
 #include <sstream>    // stringstream
@@ -21,6 +22,7 @@
 #include "../athena_arrays.hpp"
 #include "../globals.hpp"
 #include "../mesh/mesh.hpp"
+#include "bvals_coalesced.hpp"
 #include "bvals_interfaces.hpp"
 
 // MPI header
@@ -63,6 +65,8 @@ void BoundaryVariable::InitBoundaryData(BoundaryData<> &bd, BoundaryQuantity typ
 #ifdef MPI_PARALLEL
     bd.req_send[n] = MPI_REQUEST_NULL;
     bd.req_recv[n] = MPI_REQUEST_NULL;
+    bd.cid_send[n] = -1;
+    bd.cid_recv[n] = -1;
 #endif
     // Allocate buffers, calculating the buffer size (variable vs. flux correction)
     if (type == BoundaryQuantity::cc || type == BoundaryQuantity::fc) {
@@ -99,12 +103,38 @@ void BoundaryVariable::DestroyBoundaryData(BoundaryData<> &bd) {
 }
 
 
+//----------------------------------------------------------------------------------------
+//! \fn Real *BoundaryVariable::SendBufferPointer(NeighborBlock& nb, bool flcor)
+//! \brief Return the buffer into which the data for neighbor nb are packed
+//!
+//! This is bd_var_.send[nb.bufid] (or bd_var_flcor_ if flcor is true), unless the
+//! neighbor is on the same MPI rank and Mesh::direct_boundary_copy is set. In that case
+//! the data are packed directly into the receive buffer of the target block, which saves
+//! the intermediate copy through the send buffer in Copy*BufferSameProcess(). Data for
+//! another rank that are part of a coalesced message are packed into that message.
+
+Real *BoundaryVariable::SendBufferPointer(NeighborBlock& nb, bool flcor) {
+#ifdef MPI_PARALLEL
+  if (nb.snb.rank != Globals::my_rank && pbval_->coalesce_mpi_) {
+    int cid = flcor ? bd_var_flcor_.cid_send[nb.bufid] : bd_var_.cid_send[nb.bufid];
+    if (cid >= 0) return pmy_mesh_->pcbcomm->SendBuffer(cid);
+  }
+#endif
+  if (nb.snb.rank != Globals::my_rank || !pmy_mesh_->direct_boundary_copy)
+    return flcor ? bd_var_flcor_.send[nb.bufid] : bd_var_.send[nb.bufid];
+  BoundaryVariable *ptarget_bvar =
+      pmy_mesh_->FindMeshBlock(nb.snb.gid)->pbval->bvars[bvar_index];
+  return flcor ? ptarget_bvar->bd_var_flcor_.recv[nb.targetid]
+               : ptarget_bvar->bd_var_.recv[nb.targetid];
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void BoundaryVariable::CopyVariableBufferSameProcess(NeighborBlock& nb, int ssize)
 //! \brief Called in BoundaryVariable::SendBoundaryBuffer() and SendFluxCorrection()
 //! when the destination neighbor block is on the same MPI rank as the sending MeshBlcok.
 //! So std::memcpy() call requires a pointer to "void *dst" corresponding to
-//! bd_var_.recv[nb.targetid] on the target block
+//! bd_var_.recv[nb.targetid] on the target block. With Mesh::direct_boundary_copy, the
+//! data are already there (see SendBufferPointer()) and only the flag is set.
 
 void BoundaryVariable::CopyVariableBufferSameProcess(NeighborBlock& nb, int ssize) {
   // Locate target buffer
@@ -112,10 +142,13 @@ void BoundaryVariable::CopyVariableBufferSameProcess(NeighborBlock& nb, int ssiz
   MeshBlock *ptarget_block = pmy_mesh_->FindMeshBlock(nb.snb.gid);
   // 2) which element in vector of BoundaryVariable *?
   BoundaryData<> *ptarget_bdata = &(ptarget_block->pbval->bvars[bvar_index]->bd_var_);
-  std::memcpy(ptarget_bdata->recv[nb.targetid], bd_var_.send[nb.bufid],
-              ssize*sizeof(Real));
+  if (!pmy_mesh_->direct_boundary_copy)
+    std::memcpy(ptarget_bdata->recv[nb.targetid], bd_var_.send[nb.bufid],
+                ssize*sizeof(Real));
   // finally, set the BoundaryStatus flag on the destination buffer
   ptarget_bdata->flag[nb.targetid] = BoundaryStatus::arrived;
+  // and wake up the destination block if the TaskList scheduler has parked it
+  ptarget_block->NotifyBoundaryArrival();
   return;
 }
 
@@ -134,10 +167,13 @@ void BoundaryVariable::CopyFluxCorrectionBufferSameProcess(NeighborBlock& nb, in
   // 2) which element in vector of BoundaryVariable *?
   BoundaryData<> *ptarget_bdata =
       &(ptarget_block->pbval->bvars[bvar_index]->bd_var_flcor_);
-  std::memcpy(ptarget_bdata->recv[nb.targetid], bd_var_flcor_.send[nb.bufid],
-              ssize*sizeof(Real));
+  if (!pmy_mesh_->direct_boundary_copy)
+    std::memcpy(ptarget_bdata->recv[nb.targetid], bd_var_flcor_.send[nb.bufid],
+                ssize*sizeof(Real));
   // finally, set the BoundaryStatus flag on the destination buffer
   ptarget_bdata->flag[nb.targetid] = BoundaryStatus::arrived;
+  // and wake up the destination block if the TaskList scheduler has parked it
+  ptarget_block->NotifyBoundaryArrival();
   return;
 }
 
@@ -162,6 +198,7 @@ void BoundaryVariable::CopyShearBufferSameProcess(SimpleNeighborBlock& snb, int
               ssize*sizeof(Real));
   // finally, set the BoundaryStatus flag on the destination buffer
   ptarget_bdata->flag[bufid] = BoundaryStatus::arrived;
+  ptarget_block->NotifyBoundaryArrival();
   return;
 }
 
@@ -183,6 +220,7 @@ void BoundaryVariable::CopyShearFluxSameProcess(SimpleNeighborBlock& snb, int ss
               ssize*sizeof(Real));
   // finally, set the BoundaryStatus flag on the destination buffer
   ptarget_bdata->flag[bufid] = BoundaryStatus::arrived;
+  ptarget_block->NotifyBoundaryArrival();
   return;
 }
 
@@ -201,6 +239,7 @@ void BoundaryVariable::SetCompletedFlagSameProcess(NeighborBlock& nb) {
   BoundaryData<> *ptarget_bdata =
       &(ptarget_block->pbval->bvars[bvar_index]->bd_var_flcor_);
   ptarget_bdata->flag[nb.targetid] = BoundaryStatus::completed;
+  ptarget_block->NotifyBoundaryArrival();
   return;
 }
 
@@ -216,19 +255,20 @@ void BoundaryVariable::SendBoundaryBuffers() {
   for (int n=0; n<pbval_->nneighbor; n++) {
     NeighborBlock& nb = pbval_->neighbor[n];
     if (bd_var_.sflag[nb.bufid] == BoundaryStatus::completed) continue;
+    Real *sbuf = SendBufferPointer(nb, false);
     int ssize;
     if (nb.snb.level == mylevel)
-      ssize = LoadBoundaryBufferSameLevel(bd_var_.send[nb.bufid], nb);
+      ssize = LoadBoundaryBufferSameLevel(sbuf, nb);
     else if (nb.snb.level<mylevel)
-      ssize = LoadBoundaryBufferToCoarser(bd_var_.send[nb.bufid], nb);
+      ssize = LoadBoundaryBufferToCoarser(sbuf, nb);
     else
-      ssize = LoadBoundaryBufferToFiner(bd_var_.send[nb.bufid], nb);
+      ssize = LoadBoundaryBufferToFiner(sbuf, nb);
     if (nb.snb.rank == Globals::my_rank) {  // on the same process
       CopyVariableBufferSameProcess(nb, ssize);
     }
 #ifdef MPI_PARALLEL
     else  // MPI
-      MPI_Start(&(bd_var_.req_send[nb.bufid]));
+      StartSend(bd_var_, nb.bufid);
 #endif
     bd_var_.sflag[nb.bufid] = BoundaryStatus::completed;
   }
@@ -253,12 +293,7 @@ bool BoundaryVariable::ReceiveBoundaryBuffers() {
       }
 #ifdef MPI_PARALLEL
       else { // NOLINT // MPI boundary
-        int test;
-        // probe MPI communications.  This is a bit of black magic that seems to promote
-        // communications to top of stack and gets them to complete more quickly
-        MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &test, MPI_STATUS_IGNORE);
-        MPI_Test(&(bd_var_.req_recv[nb.bufid]), &test, MPI_STATUS_IGNORE);
-        if (!static_cast<bool>(test)) {
+        if (!TestRecv(bd_var_, nb.bufid)) {
           bflag = false;
           continue;
         }
@@ -327,3 +362,87 @@ void BoundaryVariable::ReceiveAndSetBoundariesWithWait() {
 }
 
 //PolarFieldBoundaryAverage();
+
+#ifdef MPI_PARALLEL
+//----------------------------------------------------------------------------------------
+//! \fn void BoundaryVariable::ClearCoalescedParts()
+//! \brief called at the beginning of SetupPersistentMPI(): all buffers use their own
+//! MPI requests until CoalesceSend() and CoalesceRecv() register them in Mesh::pcbcomm
+
+void BoundaryVariable::ClearCoalescedParts() {
+  for (int n=0; n<bd_var_.nbmax; n++)
+    bd_var_.cid_send[n] = bd_var_.cid_recv[n] = -1;
+  for (int n=0; n<bd_var_flcor_.nbmax; n++)
+    bd_var_flcor_.cid_send[n] = bd_var_flcor_.cid_recv[n] = -1;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BoundaryVariable::CoalesceSend(NeighborBlock& nb, bool flcor, int size)
+//! \brief register the send buffer for nb in Mesh::pcbcomm, if enabled for this variable
+
+void BoundaryVariable::CoalesceSend(NeighborBlock& nb, bool flcor, int size) {
+  std::vector<BoundaryVariable *> &bvars = pbval_->bvars_main_int;
+  if (pmy_mesh_->pcbcomm == nullptr
+      || std::find(bvars.begin(), bvars.end(), this) == bvars.end()) return;
+  BoundaryData<> &bd = flcor ? bd_var_flcor_ : bd_var_;
+  pmy_mesh_->pcbcomm->AddSendPart(pmy_block_->gid, static_cast<int>(bvar_index), flcor,
+                                  nb.bufid, nb.snb.rank, size, &bd.cid_send[nb.bufid]);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BoundaryVariable::CoalesceRecv(NeighborBlock& nb, bool flcor, int size)
+//! \brief register the receive buffer for nb in Mesh::pcbcomm, if enabled for this
+//! variable. The sender identifies the buffer by its own gid and bufid (nb.targetid).
+
+void BoundaryVariable::CoalesceRecv(NeighborBlock& nb, bool flcor, int size) {
+  std::vector<BoundaryVariable *> &bvars = pbval_->bvars_main_int;
+  if (pmy_mesh_->pcbcomm == nullptr
+      || std::find(bvars.begin(), bvars.end(), this) == bvars.end()) return;
+  BoundaryData<> &bd = flcor ? bd_var_flcor_ : bd_var_;
+  pmy_mesh_->pcbcomm->AddRecvPart(nb.snb.gid, static_cast<int>(bvar_index), flcor,
+                                  nb.targetid, nb.snb.rank, size,
+                                  &bd.cid_recv[nb.bufid], bd.recv[nb.bufid],
+                                  &bd.flag[nb.bufid], pmy_block_);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BoundaryVariable::StartSend(BoundaryData<> &bd, int bufid)
+//! \brief send the packed buffer bufid to the neighbor on another rank
+
+void BoundaryVariable::StartSend(BoundaryData<> &bd, int bufid) {
+  if (pbval_->coalesce_mpi_ && bd.cid_send[bufid] >= 0)
+    pmy_mesh_->pcbcomm->Send(bd.cid_send[bufid]);
+  else
+    MPI_Start(&(bd.req_send[bufid]));
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void BoundaryVariable::StartRecv(BoundaryData<> &bd, int bufid)
+//! \brief start receiving buffer bufid from the neighbor on another rank
+
+void BoundaryVariable::StartRecv(BoundaryData<> &bd, int bufid) {
+  // coalesced messages are received in CoalescedBoundaryComm::StartReceiving()
+  if (!pbval_->coalesce_mpi_ || bd.cid_recv[bufid] < 0)
+    MPI_Start(&(bd.req_recv[bufid]));
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool BoundaryVariable::TestRecv(BoundaryData<> &bd, int bufid)
+//! \brief test if buffer bufid from the neighbor on another rank has arrived
+
+bool BoundaryVariable::TestRecv(BoundaryData<> &bd, int bufid) {
+  int test;
+  // probe MPI communications.  This is a bit of black magic that seems to promote
+  // communications to top of stack and gets them to complete more quickly
+  MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &test, MPI_STATUS_IGNORE);
+  if (pbval_->coalesce_mpi_ && bd.cid_recv[bufid] >= 0)
+    return pmy_mesh_->pcbcomm->Test(bd.cid_recv[bufid]);
+  MPI_Test(&(bd.req_recv[bufid]), &test, MPI_STATUS_IGNORE);
+  return static_cast<bool>(test);
+}
+#endif
@@ -530,6 +530,7 @@ void CellCenteredBoundaryVariable::SetupPersistentMPI() {
   cng3 = cng*f3;
   int ssize, rsize;
   int tag;
+  ClearCoalescedParts();
   // Initialize non-polar neighbor communications to other ranks
   for (int n=0; n<pbval_->nneighbor; n++) {
     NeighborBlock& nb = pbval_->neighbor[n];
@@ -568,6 +569,8 @@ void CellCenteredBoundaryVariable::SetupPersistentMPI() {
         MPI_Request_free(&bd_var_.req_recv[nb.bufid]);
       MPI_Recv_init(bd_var_.recv[nb.bufid], rsize, MPI_ATHENA_REAL,
                     nb.snb.rank, tag, MPI_COMM_WORLD, &(bd_var_.req_recv[nb.bufid]));
+      CoalesceSend(nb, false, ssize);
+      CoalesceRecv(nb, false, rsize);
 
       // hydro flux correction: bd_var_flcor_
       if (nb.ni.type == NeighborConnect::face) {
@@ -587,6 +590,7 @@ void CellCenteredBoundaryVariable::SetupPersistentMPI() {
             MPI_Send_init(bd_var_flcor_.send[nb.bufid], size, MPI_ATHENA_REAL,
                           nb.snb.rank, tag, MPI_COMM_WORLD,
                           &(bd_var_flcor_.req_send[nb.bufid]));
+            CoalesceSend(nb, true, size);
           } else if (nb.snb.level > mylevel) { // receive from finer
             tag = pbval_->CreateBvalsMPITag(pmb->lid, nb.bufid, cc_flx_phys_id_);
             if (bd_var_flcor_.req_recv[nb.bufid] != MPI_REQUEST_NULL)
@@ -594,6 +598,7 @@ void CellCenteredBoundaryVariable::SetupPersistentMPI() {
             MPI_Recv_init(bd_var_flcor_.recv[nb.bufid], size, MPI_ATHENA_REAL,
                           nb.snb.rank, tag, MPI_COMM_WORLD,
                           &(bd_var_flcor_.req_recv[nb.bufid]));
+            CoalesceRecv(nb, true, size);
           }
         } else { // communication with same level
           if (nb.shear && (nb.fid == BoundaryFace::inner_x1
@@ -632,12 +637,12 @@ void CellCenteredBoundaryVariable::StartReceiving(BoundaryCommSubset phase) {
   for (int n=0; n<pbval_->nneighbor; n++) {
     NeighborBlock& nb = pbval_->neighbor[n];
     if (nb.snb.rank != Globals::my_rank) {
-      MPI_Start(&(bd_var_.req_recv[nb.bufid]));
+      StartRecv(bd_var_, nb.bufid);
       if (phase == BoundaryCommSubset::all && nb.ni.type == NeighborConnect::face) {
         if ((nb.shear&&(nb.fid == BoundaryFace::inner_x1
              || nb.fid == BoundaryFace::outer_x1)
             && pbval_->shearing_box==1) || nb.snb.level > mylevel) {
-          MPI_Start(&(bd_var_flcor_.req_recv[nb.bufid]));
+          StartRecv(bd_var_flcor_, nb.bufid);
         } else { // no recv
           bd_var_flcor_.flag[nb.bufid] = BoundaryStatus::completed;
         }
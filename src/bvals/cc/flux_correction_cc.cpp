@@ -176,9 +176,9 @@ void CellCenteredBoundaryVariable::SendFluxCorrection() {
     if (bd_var_flcor_.sflag[nb.bufid] == BoundaryStatus::completed) continue;
     int p = 0;
     if (nb.snb.level == pmb->loc.level) { // to same level
-      p = LoadFluxBoundaryBufferSameLevel(bd_var_flcor_.send[nb.bufid],nb);
+      p = LoadFluxBoundaryBufferSameLevel(SendBufferPointer(nb, true), nb);
     } else if (nb.snb.level < pmb->loc.level) { // to coaser
-      p = LoadFluxBoundaryBufferToCoarser(bd_var_flcor_.send[nb.bufid],nb);
+      p = LoadFluxBoundaryBufferToCoarser(SendBufferPointer(nb, true), nb);
     }
     // else { // to finer
     // }
@@ -188,7 +188,7 @@ void CellCenteredBoundaryVariable::SendFluxCorrection() {
         CopyFluxCorrectionBufferSameProcess(nb, p);
 #ifdef MPI_PARALLEL
       else
-        MPI_Start(&(bd_var_flcor_.req_send[nb.bufid]));
+        StartSend(bd_var_flcor_, nb.bufid);
 #endif
     } else {
       if (nb.snb.rank == Globals::my_rank) // on the same node
@@ -304,13 +304,7 @@ bool CellCenteredBoundaryVariable::ReceiveFluxCorrection() {
       }
 #ifdef MPI_PARALLEL
       else { // NOLINT
-        int test;
-        // probe MPI communications.  This is a bit of black magic that seems to promote
-        // communications to top of stack and gets them to complete more quickly
-        MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &test,
-                   MPI_STATUS_IGNORE);
-        MPI_Test(&(bd_var_flcor_.req_recv[nb.bufid]), &test, MPI_STATUS_IGNORE);
-        if (!static_cast<bool>(test)) {
+        if (!TestRecv(bd_var_flcor_, nb.bufid)) {
           flag = false;
           continue;
         }
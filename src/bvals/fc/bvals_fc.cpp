@@ -1208,6 +1208,7 @@ void FaceCenteredBoundaryVariable::SetupPersistentMPI() {
   cng3 = cng*f3;
   int ssize, rsize;
   int tag;
+  ClearCoalescedParts();
   // Initialize non-polar neighbor communications to other ranks
   for (int n=0; n<pbval_->nneighbor; n++) {
     NeighborBlock& nb = pbval_->neighbor[n];
@@ -1274,6 +1275,8 @@ void FaceCenteredBoundaryVariable::SetupPersistentMPI() {
         MPI_Request_free(&bd_var_.req_recv[nb.bufid]);
       MPI_Recv_init(bd_var_.recv[nb.bufid], rsize, MPI_ATHENA_REAL,
                     nb.snb.rank, tag, MPI_COMM_WORLD, &(bd_var_.req_recv[nb.bufid]));
+      CoalesceSend(nb, false, ssize);
+      CoalesceRecv(nb, false, rsize);
 
       // emf correction
       int f2csize;
@@ -1338,6 +1341,8 @@ void FaceCenteredBoundaryVariable::SetupPersistentMPI() {
           MPI_Recv_init(bd_var_flcor_.recv[nb.bufid], size, MPI_ATHENA_REAL,
                         nb.snb.rank, tag, MPI_COMM_WORLD,
                         &(bd_var_flcor_.req_recv[nb.bufid]));
+          CoalesceSend(nb, true, size);
+          CoalesceRecv(nb, true, size);
         }
       }
       if (nb.snb.level>mylevel) { // finer neighbor
@@ -1347,6 +1352,7 @@ void FaceCenteredBoundaryVariable::SetupPersistentMPI() {
         MPI_Recv_init(bd_var_flcor_.recv[nb.bufid], f2csize, MPI_ATHENA_REAL,
                       nb.snb.rank, tag, MPI_COMM_WORLD,
                       &(bd_var_flcor_.req_recv[nb.bufid]));
+        CoalesceRecv(nb, true, f2csize);
       }
       if (nb.snb.level<mylevel) { // coarser neighbor
         tag = pbval_->CreateBvalsMPITag(nb.snb.lid, nb.targetid, fc_flx_phys_id_);
@@ -1355,6 +1361,7 @@ void FaceCenteredBoundaryVariable::SetupPersistentMPI() {
         MPI_Send_init(bd_var_flcor_.send[nb.bufid], f2csize, MPI_ATHENA_REAL,
                       nb.snb.rank, tag, MPI_COMM_WORLD,
                       &(bd_var_flcor_.req_send[nb.bufid]));
+        CoalesceSend(nb, true, f2csize);
       }
     } // neighbor block is on separate MPI process
   } // end loop over neighbors
@@ -1407,14 +1414,14 @@ void FaceCenteredBoundaryVariable::StartReceiving(BoundaryCommSubset phase) {
   for (int n=0; n<pbval_->nneighbor; n++) {
     NeighborBlock& nb = pbval_->neighbor[n];
     if (nb.snb.rank != Globals::my_rank && phase != BoundaryCommSubset::gr_amr) {
-      MPI_Start(&(bd_var_.req_recv[nb.bufid]));
+      StartRecv(bd_var_, nb.bufid);
       if (phase == BoundaryCommSubset::all &&
           (nb.ni.type == NeighborConnect::face || nb.ni.type == NeighborConnect::edge)) {
         if ((nb.snb.level > mylevel) ||
             ((nb.snb.level == mylevel) && ((nb.ni.type == NeighborConnect::face)
                                            || ((nb.ni.type == NeighborConnect::edge)
                                                && (edge_flag_[nb.eid])))))
-          MPI_Start(&(bd_var_flcor_.req_recv[nb.bufid]));
+          StartRecv(bd_var_flcor_, nb.bufid);
       }
     }
   }
@@ -601,18 +601,21 @@ void FaceCenteredBoundaryVariable::CopyPolarBufferSameProcess(
           ptarget_block->pbval->bvars[bvar_index]);
   Real *target_buf, *send_buf;
 
+  BoundaryStatus *target_flag;
+
   if (is_north) {
     target_buf= ptarget_pfbval->flux_north_recv_[pmy_block_->loc.lx3];
     send_buf = flux_north_send_[polar_block_index];
-    BoundaryStatus &target_flag = ptarget_pfbval->flux_north_flag_[pmy_block_->loc.lx3];
-    target_flag = BoundaryStatus::arrived;
+    target_flag = &(ptarget_pfbval->flux_north_flag_[pmy_block_->loc.lx3]);
   } else {
     target_buf= ptarget_pfbval->flux_south_recv_[pmy_block_->loc.lx3];
     send_buf = flux_south_send_[polar_block_index];
-    BoundaryStatus &target_flag = ptarget_pfbval->flux_south_flag_[pmy_block_->loc.lx3];
-    target_flag = BoundaryStatus::arrived;
+    target_flag = &(ptarget_pfbval->flux_south_flag_[pmy_block_->loc.lx3]);
   }
   std::memcpy(target_buf, send_buf, ssize*sizeof(Real));
+  // only flag the data as arrived once the copy is complete
+  *target_flag = BoundaryStatus::arrived;
+  ptarget_block->NotifyBoundaryArrival();
   return;
 }
 
@@ -634,12 +637,12 @@ void FaceCenteredBoundaryVariable::SendFluxCorrection() {
       if ((nb.ni.type == NeighborConnect::face)
           || ((nb.ni.type == NeighborConnect::edge)
               && (edge_flag_[nb.eid]))) {
-        p = LoadFluxBoundaryBufferSameLevel(bd_var_flcor_.send[nb.bufid], nb);
+        p = LoadFluxBoundaryBufferSameLevel(SendBufferPointer(nb, true), nb);
       } else {
         continue;
       }
     } else if (nb.snb.level == pmb->loc.level-1) {
-      p = LoadFluxBoundaryBufferToCoarser(bd_var_flcor_.send[nb.bufid], nb);
+      p = LoadFluxBoundaryBufferToCoarser(SendBufferPointer(nb, true), nb);
     } else {
       continue;
     }
@@ -648,7 +651,7 @@ void FaceCenteredBoundaryVariable::SendFluxCorrection() {
     }
 #ifdef MPI_PARALLEL
     else
-      MPI_Start(&(bd_var_flcor_.req_send[nb.bufid]));
+      StartSend(bd_var_flcor_, nb.bufid);
 #endif
     bd_var_flcor_.sflag[nb.bufid] = BoundaryStatus::completed;
   }
@@ -1628,14 +1631,7 @@ bool FaceCenteredBoundaryVariable::ReceiveFluxCorrection() {
           }
 #ifdef MPI_PARALLEL
           else { // NOLINT
-            int test;
-            // probe MPI communications.  This is a bit of black magic that seems to
-            // promote communications to top of stack and gets them to complete more
-            // quickly
-            MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &test,
-                       MPI_STATUS_IGNORE);
-            MPI_Test(&(bd_var_flcor_.req_recv[nb.bufid]), &test, MPI_STATUS_IGNORE);
-            if (!static_cast<bool>(test) ) {
+            if (!TestRecv(bd_var_flcor_, nb.bufid)) {
               flag = false;
               continue;
             }
@@ -1669,11 +1665,7 @@ bool FaceCenteredBoundaryVariable::ReceiveFluxCorrection() {
         }
 #ifdef MPI_PARALLEL
         else { // NOLINT
-          int test;
-          MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &test,
-                     MPI_STATUS_IGNORE);
-          MPI_Test(&(bd_var_flcor_.req_recv[nb.bufid]), &test, MPI_STATUS_IGNORE);
-          if (!static_cast<bool>(test)) {
+          if (!TestRecv(bd_var_flcor_, nb.bufid)) {
             flag = false;
             continue;
           }
@@ -623,6 +623,7 @@ void OrbitalBoundaryCommunication::SendBoundaryBuffersCC() {
           std::memcpy(obd.recv[0], orbital_bd_cc_[upper].send[n], p*sizeof(Real));
           obd.flag[0] = BoundaryStatus::arrived;
         }
+        tmb->NotifyBoundaryArrival();
       } else {
 #ifdef MPI_PARALLEL
         if (snb.level == mylevel) { // to same level
@@ -763,6 +764,7 @@ void OrbitalBoundaryCommunication::SendBoundaryBuffersFC() {
           std::memcpy(obd.recv[0], orbital_bd_fc_[upper].send[n], p*sizeof(Real));
           obd.flag[0] = BoundaryStatus::arrived;
         }
+        tmb->NotifyBoundaryArrival();
       } else {
 #ifdef MPI_PARALLEL
         if (snb.level == mylevel) { // to same level
@@ -10,21 +10,40 @@
 
 // C++ headers
 #include <algorithm>
+#include <cstddef>    // std::size_t
+#include <iomanip>    // std::setprecision
+#include <iostream>   // std::cout
 
 // Athena++ headers
 #include "../athena.hpp"
 #include "../athena_arrays.hpp"
 #include "../bvals/bvals.hpp"
+#include "../globals.hpp"
 #include "../hydro/hydro.hpp"
 #include "../mesh/mesh.hpp"
 #include "../parameter_input.hpp"
 #include "coordinates.hpp"
 
+namespace {
+//! print the state and size per MeshBlock of one of the optional Coordinates caches
+void PrintCacheSize(const char *label, bool cached, std::size_t nbytes) {
+  std::ios_base::fmtflags flags = std::cout.flags();
+  std::streamsize precision = std::cout.precision();
+  std::cout << label << ": " << (cached ? "on, " : "off, would take ")
+            << std::fixed << std::setprecision(2) << nbytes/1048576.0
+            << " MiB per MeshBlock" << std::endl;
+  std::cout.flags(flags);
+  std::cout.precision(precision);
+  return;
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------
 //! Coordinates constructor: sets coordinates and coordinate spacing of cell FACES
 
 Coordinates::Coordinates(MeshBlock *pmb, ParameterInput *pin, bool flag) :
-    pmy_block(pmb), coarse_flag(flag), pm(pmb->pmy_mesh) {
+    pmy_block(pmb), coarse_flag(flag), pm(pmb->pmy_mesh), geometry_cached_(false),
+    metric_cached_(false), pmy_pin_(pin) {
   RegionSize& mesh_size  = pmy_block->pmy_mesh->mesh_size;
   RegionSize& block_size = pmy_block->block_size;
 
@@ -784,3 +803,208 @@ void Coordinates::Metric(
   pmy_block->pmy_mesh->UserMetric_(x1, x2, x3, pin, g, g_inv, dg_dx1, dg_dx2, dg_dx3);
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::CacheMetric(ParameterInput *pin)
+//! \brief if <coord>/cache_metric = true, store the cell- and face-centered metric of
+//!        a static spacetime that does not depend on x3, so that CellMetric() and
+//!        FaceNMetric() copy it instead of recomputing it for every pencil.
+//!
+//! Must be called at the end of the constructor of the derived class, which fills the
+//! cache through its own CellMetric(), Face1Metric() and Face2Metric(). The Coordinates
+//! of every new MeshBlock (AMR, load balancing) build their own cache.
+
+void Coordinates::CacheMetric(ParameterInput *pin) {
+  const std::size_t nbytes = sizeof(Real)*2*NMETRIC*(nc2*nc1 + nc2*(nc1+1)
+                                                     + (nc2+1)*nc1);
+  metric_cached_ = pin->GetOrAddBoolean("coord", "cache_metric", false);
+  if (coarse_flag) {
+    metric_cached_ = false;
+    return;
+  }
+  ReportMetricCache(nbytes);
+  if (!metric_cached_) return;
+
+  metric_cached_ = false;  // the metric functions below must compute the values
+  int jll = jl, juu = ju;
+  if (pmy_block->block_size.nx2 > 1) {
+    jll -= ng;
+    juu += ng;
+  }
+  metric_cell_ji_.NewAthenaArray(2, NMETRIC, nc2, nc1);
+  metric_face1_ji_.NewAthenaArray(2, NMETRIC, nc2, nc1+1);
+  metric_face2_ji_.NewAthenaArray(2, NMETRIC, nc2+1, nc1);
+  for (int j=jll; j<=juu+1; ++j) {
+    if (j <= juu) {
+      CellMetric(kl, j, il-ng, iu+ng, g_, gi_);
+      for (int n=0; n<NMETRIC; ++n) {
+        for (int i=il-ng; i<=iu+ng; ++i) {
+          metric_cell_ji_(0,n,j,i) = g_(n,i);
+          metric_cell_ji_(1,n,j,i) = gi_(n,i);
+        }
+      }
+      Face1Metric(kl, j, il-ng, iu+ng+1, g_, gi_);
+      for (int n=0; n<NMETRIC; ++n) {
+        for (int i=il-ng; i<=iu+ng+1; ++i) {
+          metric_face1_ji_(0,n,j,i) = g_(n,i);
+          metric_face1_ji_(1,n,j,i) = gi_(n,i);
+        }
+      }
+    }
+    Face2Metric(kl, j, il-ng, iu+ng, g_, gi_);
+    for (int n=0; n<NMETRIC; ++n) {
+      for (int i=il-ng; i<=iu+ng; ++i) {
+        metric_face2_ji_(0,n,j,i) = g_(n,i);
+        metric_face2_ji_(1,n,j,i) = gi_(n,i);
+      }
+    }
+  }
+  metric_cached_ = true;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::LoadMetric(const AthenaArray<Real> &cache, const int j,
+//!          const int il, const int iu, AthenaArray<Real> &g, AthenaArray<Real> &g_inv)
+//! \brief copy the pencil j of a metric cache built by CacheMetric() into g and g_inv
+
+void Coordinates::LoadMetric(const AthenaArray<Real> &cache, const int j, const int il,
+                             const int iu, AthenaArray<Real> &g,
+                             AthenaArray<Real> &g_inv) {
+  for (int n=0; n<NMETRIC; ++n) {
+#pragma omp simd
+    for (int i=il; i<=iu; ++i) {
+      g(n,i) = cache(0,n,j,i);
+      g_inv(n,i) = cache(1,n,j,i);
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::ReportMetricCache(std::size_t nbytes)
+//! \brief print, once per run, whether the GR metric is cached and the size of the cache
+//!        (or the size it would have) per MeshBlock
+
+void Coordinates::ReportMetricCache(std::size_t nbytes) {
+  static bool reported = false;
+  if (reported || Globals::my_rank != 0) return;
+  reported = true;
+  PrintCacheSize("GR metric cache (<coord>/cache_metric)", metric_cached_, nbytes);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::CacheGeometry(ParameterInput *pin)
+//! \brief if <coord>/cache_geometry = true, store the face areas and inverse cell
+//!        volumes of the active cells of the MeshBlock for CachedFluxDivergence()
+//!
+//! Trades 3-4 Reals per cell of memory for not calling FaceNArea() and CellVolume() on
+//! every pencil of every stage, which is real work in curvilinear coordinates. Called
+//! by the MeshBlock constructors once the derived class is complete; the coarse
+//! Coordinates used by mesh refinement never cache.
+
+void Coordinates::CacheGeometry(ParameterInput *pin) {
+  MeshBlock *pmb = pmy_block;
+  const bool x2_active = (pmb->block_size.nx2 > 1), x3_active = (pmb->block_size.nx3 > 1);
+  int is = pmb->is, js = pmb->js, ks = pmb->ks;
+  int ie = pmb->ie, je = pmb->je, ke = pmb->ke;
+  std::size_t ncells = nc3*nc2*(nc1+1) + nc3*nc2*nc1;
+  if (x2_active) ncells += nc3*(nc2+1)*nc1;
+  if (x3_active) ncells += (nc3+1)*nc2*nc1;
+
+  geometry_cached_ = pin->GetOrAddBoolean("coord", "cache_geometry", false);
+  if (coarse_flag) {
+    geometry_cached_ = false;
+    return;
+  }
+  static bool reported = false;
+  if (!reported && Globals::my_rank == 0) {
+    reported = true;
+    PrintCacheSize("Geometry cache (<coord>/cache_geometry)", geometry_cached_,
+                   sizeof(Real)*ncells);
+  }
+  if (!geometry_cached_) return;
+
+  // the FaceNArea() and CellVolume() functions below must compute the values
+  geometry_cached_ = false;
+  AthenaArray<Real> row(nc1+1);
+  cache_area1_kji_.NewAthenaArray(nc3, nc2, nc1+1);
+  cache_inv_vol_kji_.NewAthenaArray(nc3, nc2, nc1);
+  if (x2_active) cache_area2_kji_.NewAthenaArray(nc3, nc2+1, nc1);
+  if (x3_active) cache_area3_kji_.NewAthenaArray(nc3+1, nc2, nc1);
+  for (int k=ks; k<=ke+1; ++k) {
+    for (int j=js; j<=je+1; ++j) {
+      if (k <= ke && j <= je) {
+        Face1Area(k, j, is, ie+1, row);
+        for (int i=is; i<=ie+1; ++i)
+          cache_area1_kji_(k,j,i) = row(i);
+        CellVolume(k, j, is, ie, row);
+        for (int i=is; i<=ie; ++i)
+          cache_inv_vol_kji_(k,j,i) = 1.0/row(i);
+      }
+      if (x2_active && k <= ke) {
+        Face2Area(k, j, is, ie, row);
+        for (int i=is; i<=ie; ++i)
+          cache_area2_kji_(k,j,i) = row(i);
+      }
+      if (x3_active && j <= je) {
+        Face3Area(k, j, is, ie, row);
+        for (int i=is; i<=ie; ++i)
+          cache_area3_kji_(k,j,i) = row(i);
+      }
+    }
+  }
+  geometry_cached_ = true;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::CachedFluxDivergence(const AthenaArray<Real> *flux,
+//!          const int nl, const int nu, const int k, const int j, const int il,
+//!          const int iu, AthenaArray<Real> &div)
+//! \brief div(n,i) = divergence of the fluxes of the variables n=nl...nu in the pencil
+//!        (k,j), from the geometry stored by CacheGeometry(), in a single pass
+//!
+//! The terms are summed in the same order as in Hydro::AddFluxDivergence(), but the
+//! multiplication by the inverse volume makes the result differ from the uncached one
+//! by roundoff.
+
+void Coordinates::CachedFluxDivergence(const AthenaArray<Real> *flux, const int nl,
+                                       const int nu, const int k, const int j,
+                                       const int il, const int iu,
+                                       AthenaArray<Real> &div) {
+  const AthenaArray<Real> &x1flux = flux[X1DIR], &x2flux = flux[X2DIR],
+                          &x3flux = flux[X3DIR];
+  const AthenaArray<Real> &a1 = cache_area1_kji_, &a2 = cache_area2_kji_,
+                          &a3 = cache_area3_kji_, &ivol = cache_inv_vol_kji_;
+  if (pmy_block->block_size.nx3 > 1) {
+    for (int n=nl; n<=nu; ++n) {
+#pragma omp simd
+      for (int i=il; i<=iu; ++i) {
+        div(n,i) = ((a1(k,j,i+1)*x1flux(n,k,j,i+1) - a1(k,j,i)*x1flux(n,k,j,i))
+                    + (a2(k,j+1,i)*x2flux(n,k,j+1,i) - a2(k,j,i)*x2flux(n,k,j,i))
+                    + (a3(k+1,j,i)*x3flux(n,k+1,j,i) - a3(k,j,i)*x3flux(n,k,j,i)))
+                   *ivol(k,j,i);
+      }
+    }
+  } else if (pmy_block->block_size.nx2 > 1) {
+    for (int n=nl; n<=nu; ++n) {
+#pragma omp simd
+      for (int i=il; i<=iu; ++i) {
+        div(n,i) = ((a1(k,j,i+1)*x1flux(n,k,j,i+1) - a1(k,j,i)*x1flux(n,k,j,i))
+                    + (a2(k,j+1,i)*x2flux(n,k,j+1,i) - a2(k,j,i)*x2flux(n,k,j,i)))
+                   *ivol(k,j,i);
+      }
+    }
+  } else {
+    for (int n=nl; n<=nu; ++n) {
+#pragma omp simd
+      for (int i=il; i<=iu; ++i) {
+        div(n,i) = (a1(k,j,i+1)*x1flux(n,k,j,i+1) - a1(k,j,i)*x1flux(n,k,j,i))
+                   *ivol(k,j,i);
+      }
+    }
+  }
+  return;
+}
@@ -15,6 +15,7 @@
 // C headers
 
 // C++ headers
+#include <cstddef>   // std::size_t
 #include <iostream>
 
 // Athena++ headers
@@ -133,6 +134,13 @@ class Coordinates {
   // ...to determine if index is a pole
   bool IsPole(int j);
 
+  // ...to use the face areas and inverse volumes cached with <coord>/cache_geometry
+  void CacheGeometry(ParameterInput *pin);
+  bool GeometryCached() const {return geometry_cached_;}
+  void CachedFluxDivergence(const AthenaArray<Real> *flux, const int nl, const int nu,
+                            const int k, const int j, const int il, const int iu,
+                            AthenaArray<Real> &div);
+
 
   // In GR, functions...
   // ...to return private variables
@@ -246,6 +254,11 @@ class Coordinates {
   // Scratch arrays for physical source terms
   AthenaArray<Real> phy_src1_i_, phy_src2_i_;
 
+  // face areas and inverse volumes of the active cells, see CacheGeometry()
+  AthenaArray<Real> cache_area1_kji_, cache_area2_kji_, cache_area3_kji_;
+  AthenaArray<Real> cache_inv_vol_kji_;
+  bool geometry_cached_;  // <coord>/cache_geometry
+
   // GR-specific scratch arrays
   AthenaArray<Real> metric_cell_i1_, metric_cell_i2_;
   AthenaArray<Real> metric_cell_j1_, metric_cell_j2_;
@@ -275,10 +288,22 @@ class Coordinates {
     trans_face3_ji4_, trans_face3_ji5_, trans_face3_ji6_;
   AthenaArray<Real> trans_face3_kji_;
   AthenaArray<Real> g_, gi_;
+  // GR metric cache for spacetimes that do not depend on x3, see CacheMetric()
+  AthenaArray<Real> metric_cell_ji_, metric_face1_ji_, metric_face2_ji_;
+  // GR pointwise scratch arrays, for recomputing the GRUser metric
+  AthenaArray<Real> g_pt_, gi_pt_, dg_dx1_pt_, dg_dx2_pt_, dg_dx3_pt_, trans_pt_;
 
   // GR-specific variables
   Real bh_mass_;
   Real bh_spin_;
+  bool metric_cached_;          // <coord>/cache_metric
+  ParameterInput *pmy_pin_;     // for the GRUser metric, when it is not cached
+
+  // GR metric cache functions
+  void CacheMetric(ParameterInput *pin);
+  void LoadMetric(const AthenaArray<Real> &cache, const int j, const int il,
+                  const int iu, AthenaArray<Real> &g, AthenaArray<Real> &g_inv);
+  void ReportMetricCache(std::size_t nbytes);
 };
 
 //----------------------------------------------------------------------------------------
@@ -745,6 +770,10 @@ class GRUser : public Coordinates {
                        Real *pa0, Real *pa1, Real *pa2, Real *pa3) final;
   void LowerVectorCell(Real a0, Real a1, Real a2, Real a3, int k, int j, int i,
                        Real *pa_0, Real *pa_1, Real *pa_2, Real *pa_3) final;
+
+ private:
+  // ...to recompute the face-centered metric and transformation if they are not stored
+  void FacePencil(const int dir, const int k, const int j, const int il, const int iu);
 };
 
 #endif // COORDINATES_COORDINATES_HPP_
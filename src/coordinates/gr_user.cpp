@@ -151,14 +151,35 @@ GRUser::GRUser(MeshBlock *pmb, ParameterInput *pin, bool flag)
     coord_width2_kji_.NewAthenaArray(nc3, nc2, nc1);
     coord_width3_kji_.NewAthenaArray(nc3, nc2, nc1);
     coord_src_kji_.NewAthenaArray(3, NMETRIC, nc3, nc2, nc1);
-    metric_face1_kji_.NewAthenaArray(2, NMETRIC, nc3, nc2, nc1+1);
-    metric_face2_kji_.NewAthenaArray(2, NMETRIC, nc3, nc2+1, nc1);
-    metric_face3_kji_.NewAthenaArray(2, NMETRIC, nc3+1, nc2, nc1);
-    trans_face1_kji_.NewAthenaArray(2, NMETRIC, nc3, nc2, nc1+1);
-    trans_face2_kji_.NewAthenaArray(2, NMETRIC, nc3, nc2+1, nc1);
-    trans_face3_kji_.NewAthenaArray(2, NMETRIC, nc3+1, nc2, nc1);
     g_.NewAthenaArray(NMETRIC, nc1+1);
     gi_.NewAthenaArray(NMETRIC, nc1+1);
+
+    // Face-centered metric and frame transformations: stored for the whole MeshBlock, or
+    // recomputed for every pencil if memory is tight (see FacePencil())
+    metric_cached_ = pin->GetOrAddBoolean("coord", "cache_metric", true);
+    ReportMetricCache(sizeof(Real)*4*NMETRIC*(nc3*nc2*(nc1+1) + nc3*(nc2+1)*nc1
+                                              + (nc3+1)*nc2*nc1));
+    if (metric_cached_) {
+      metric_face1_kji_.NewAthenaArray(2, NMETRIC, nc3, nc2, nc1+1);
+      metric_face2_kji_.NewAthenaArray(2, NMETRIC, nc3, nc2+1, nc1);
+      metric_face3_kji_.NewAthenaArray(2, NMETRIC, nc3+1, nc2, nc1);
+      trans_face1_kji_.NewAthenaArray(2, NMETRIC, nc3, nc2, nc1+1);
+      trans_face2_kji_.NewAthenaArray(2, NMETRIC, nc3, nc2+1, nc1);
+      trans_face3_kji_.NewAthenaArray(2, NMETRIC, nc3+1, nc2, nc1);
+    } else {
+      metric_face1_kji_.NewAthenaArray(2, NMETRIC, 1, 1, nc1+1);
+      metric_face2_kji_.NewAthenaArray(2, NMETRIC, 1, 1, nc1);
+      metric_face3_kji_.NewAthenaArray(2, NMETRIC, 1, 1, nc1);
+      trans_face1_kji_.NewAthenaArray(2, NMETRIC, 1, 1, nc1+1);
+      trans_face2_kji_.NewAthenaArray(2, NMETRIC, 1, 1, nc1);
+      trans_face3_kji_.NewAthenaArray(2, NMETRIC, 1, 1, nc1);
+      g_pt_.NewAthenaArray(NMETRIC);
+      gi_pt_.NewAthenaArray(NMETRIC);
+      dg_dx1_pt_.NewAthenaArray(NMETRIC);
+      dg_dx2_pt_.NewAthenaArray(NMETRIC);
+      dg_dx3_pt_.NewAthenaArray(NMETRIC);
+      trans_pt_.NewAthenaArray(2, NTRIANGULAR);
+    }
   }
 
   // Allocate scratch arrays
@@ -237,17 +258,17 @@ GRUser::GRUser(MeshBlock *pmb, ParameterInput *pin, bool flag)
           Real det = Determinant(g);
           coord_area1_kji_(k,j,i) = std::sqrt(-det) * dx2 * dx3;
 
-          // Set metric coefficients
-          for (int n = 0; n < NMETRIC; ++n) {
-            metric_face1_kji_(0,n,k,j,i) = g(n);
-            metric_face1_kji_(1,n,k,j,i) = g_inv(n);
-          }
-
-          // Calculate frame transformation
-          CalculateTransformation(g, g_inv, 1, transformation);
-          for (int n = 0; n < 2; ++n) {
-            for (int m = 0; m < NTRIANGULAR; ++m) {
-              trans_face1_kji_(n,m,k,j,i) = transformation(n,m);
+          // Set metric coefficients and calculate frame transformation
+          if (metric_cached_) {
+            for (int n = 0; n < NMETRIC; ++n) {
+              metric_face1_kji_(0,n,k,j,i) = g(n);
+              metric_face1_kji_(1,n,k,j,i) = g_inv(n);
+            }
+            CalculateTransformation(g, g_inv, 1, transformation);
+            for (int n = 0; n < 2; ++n) {
+              for (int m = 0; m < NTRIANGULAR; ++m) {
+                trans_face1_kji_(n,m,k,j,i) = transformation(n,m);
+              }
             }
           }
         }
@@ -274,17 +295,17 @@ GRUser::GRUser(MeshBlock *pmb, ParameterInput *pin, bool flag)
           Real det = Determinant(g);
           coord_area2_kji_(k,j,i) = std::sqrt(-det) * dx1 * dx3;
 
-          // Set metric coefficients
-          for (int n = 0; n < NMETRIC; ++n) {
-            metric_face2_kji_(0,n,k,j,i) = g(n);
-            metric_face2_kji_(1,n,k,j,i) = g_inv(n);
-          }
-
-          // Calculate frame transformation
-          CalculateTransformation(g, g_inv, 2, transformation);
-          for (int n = 0; n < 2; ++n) {
-            for (int m = 0; m < NTRIANGULAR; ++m) {
-              trans_face2_kji_(n,m,k,j,i) = transformation(n,m);
+          // Set metric coefficients and calculate frame transformation
+          if (metric_cached_) {
+            for (int n = 0; n < NMETRIC; ++n) {
+              metric_face2_kji_(0,n,k,j,i) = g(n);
+              metric_face2_kji_(1,n,k,j,i) = g_inv(n);
+            }
+            CalculateTransformation(g, g_inv, 2, transformation);
+            for (int n = 0; n < 2; ++n) {
+              for (int m = 0; m < NTRIANGULAR; ++m) {
+                trans_face2_kji_(n,m,k,j,i) = transformation(n,m);
+              }
             }
           }
         }
@@ -311,17 +332,17 @@ GRUser::GRUser(MeshBlock *pmb, ParameterInput *pin, bool flag)
           Real det = Determinant(g);
           coord_area3_kji_(k,j,i) = std::sqrt(-det) * dx1 * dx2;
 
-          // Set metric coefficients
-          for (int n = 0; n < NMETRIC; ++n) {
-            metric_face3_kji_(0,n,k,j,i) = g(n);
-            metric_face3_kji_(1,n,k,j,i) = g_inv(n);
-          }
-
-          // Calculate frame transformation
-          CalculateTransformation(g, g_inv, 3, transformation);
-          for (int n = 0; n < 2; ++n) {
-            for (int m = 0; m < NTRIANGULAR; ++m) {
-              trans_face3_kji_(n,m,k,j,i) = transformation(n,m);
+          // Set metric coefficients and calculate frame transformation
+          if (metric_cached_) {
+            for (int n = 0; n < NMETRIC; ++n) {
+              metric_face3_kji_(0,n,k,j,i) = g(n);
+              metric_face3_kji_(1,n,k,j,i) = g_inv(n);
+            }
+            CalculateTransformation(g, g_inv, 3, transformation);
+            for (int n = 0; n < 2; ++n) {
+              for (int m = 0; m < NTRIANGULAR; ++m) {
+                trans_face3_kji_(n,m,k,j,i) = transformation(n,m);
+              }
             }
           }
         }
@@ -737,11 +758,18 @@ void GRUser::CellMetric(const int k, const int j, const int il, const int iu,
 
 void GRUser::Face1Metric(const int k, const int j, const int il, const int iu,
                          AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(1, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   for (int n = 0; n < NMETRIC; ++n) {
 #pragma omp simd
     for (int i=il; i<=iu; ++i) {
-      g(n,i) = metric_face1_kji_(0,n,k,j,i);
-      g_inv(n,i) = metric_face1_kji_(1,n,k,j,i);
+      g(n,i) = metric_face1_kji_(0,n,kf,jf,i);
+      g_inv(n,i) = metric_face1_kji_(1,n,kf,jf,i);
     }
   }
   return;
@@ -749,11 +777,18 @@ void GRUser::Face1Metric(const int k, const int j, const int il, const int iu,
 
 void GRUser::Face2Metric(const int k, const int j, const int il, const int iu,
                          AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(2, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   for (int n = 0; n < NMETRIC; ++n) {
 #pragma omp simd
     for (int i=il; i<=iu; ++i) {
-      g(n,i) = metric_face2_kji_(0,n,k,j,i);
-      g_inv(n,i) = metric_face2_kji_(1,n,k,j,i);
+      g(n,i) = metric_face2_kji_(0,n,kf,jf,i);
+      g_inv(n,i) = metric_face2_kji_(1,n,kf,jf,i);
     }
   }
   return;
@@ -761,11 +796,57 @@ void GRUser::Face2Metric(const int k, const int j, const int il, const int iu,
 
 void GRUser::Face3Metric(const int k, const int j, const int il, const int iu,
                          AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(3, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   for (int n = 0; n < NMETRIC; ++n) {
 #pragma omp simd
     for (int i=il; i<=iu; ++i) {
-      g(n,i) = metric_face3_kji_(0,n,k,j,i);
-      g_inv(n,i) = metric_face3_kji_(1,n,k,j,i);
+      g(n,i) = metric_face3_kji_(0,n,kf,jf,i);
+      g_inv(n,i) = metric_face3_kji_(1,n,kf,jf,i);
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// Function for recomputing the face-centered metric and frame transformation of a pencil
+// Inputs:
+//   dir: face direction (1, 2 or 3)
+//   k,j: x3- and x2-indices
+//   il,iu: x1-index bounds
+// Outputs:
+//   metric_faceN_kji_(...,0,0,i), trans_faceN_kji_(...,0,0,i): values for the pencil
+// Notes:
+//   used instead of the stored values if <coord>/cache_metric = false
+
+void GRUser::FacePencil(const int dir, const int k, const int j, const int il,
+                        const int iu) {
+  AthenaArray<Real> &metric = (dir == 1) ? metric_face1_kji_ :
+                              ((dir == 2) ? metric_face2_kji_ : metric_face3_kji_);
+  AthenaArray<Real> &trans = (dir == 1) ? trans_face1_kji_ :
+                             ((dir == 2) ? trans_face2_kji_ : trans_face3_kji_);
+  for (int i=il; i<=iu; ++i) {
+    // Get position
+    Real x1 = (dir == 1) ? x1f(i) : x1v(i);
+    Real x2 = (dir == 2) ? x2f(j) : x2v(j);
+    Real x3 = (dir == 3) ? x3f(k) : x3v(k);
+
+    // Calculate metric coefficients and frame transformation
+    Metric(x1, x2, x3, pmy_pin_, g_pt_, gi_pt_, dg_dx1_pt_, dg_dx2_pt_, dg_dx3_pt_);
+    for (int n = 0; n < NMETRIC; ++n) {
+      metric(0,n,0,0,i) = g_pt_(n);
+      metric(1,n,0,0,i) = gi_pt_(n);
+    }
+    CalculateTransformation(g_pt_, gi_pt_, dir, trans_pt_);
+    for (int n = 0; n < 2; ++n) {
+      for (int m = 0; m < NTRIANGULAR; ++m) {
+        trans(n,m,0,0,i) = trans_pt_(n,m);
+      }
     }
   }
   return;
@@ -796,23 +877,30 @@ void GRUser::PrimToLocal1(
     const int k, const int j, const int il, const int iu,
     const AthenaArray<Real> &bb1, AthenaArray<Real> &prim_l, AthenaArray<Real> &prim_r,
     AthenaArray<Real> &bbx) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(1, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   // Go through 1D block of cells
 #pragma omp simd
   for (int i=il; i<=iu; ++i) {
     // Extract transformation coefficients
-    const Real &mt_0 = trans_face1_kji_(1,T00,k,j,i);
-    const Real &mx_0 = trans_face1_kji_(1,T10,k,j,i);
-    const Real &mx_1 = trans_face1_kji_(1,T11,k,j,i);
+    const Real &mt_0 = trans_face1_kji_(1,T00,kf,jf,i);
+    const Real &mx_0 = trans_face1_kji_(1,T10,kf,jf,i);
+    const Real &mx_1 = trans_face1_kji_(1,T11,kf,jf,i);
     Real mx_2 = 0.0;
     Real mx_3 = 0.0;
-    const Real &my_0 = trans_face1_kji_(1,T20,k,j,i);
-    const Real &my_1 = trans_face1_kji_(1,T21,k,j,i);
-    const Real &my_2 = trans_face1_kji_(1,T22,k,j,i);
+    const Real &my_0 = trans_face1_kji_(1,T20,kf,jf,i);
+    const Real &my_1 = trans_face1_kji_(1,T21,kf,jf,i);
+    const Real &my_2 = trans_face1_kji_(1,T22,kf,jf,i);
     Real my_3 = 0.0;
-    const Real &mz_0 = trans_face1_kji_(1,T30,k,j,i);
-    const Real &mz_1 = trans_face1_kji_(1,T31,k,j,i);
-    const Real &mz_2 = trans_face1_kji_(1,T32,k,j,i);
-    const Real &mz_3 = trans_face1_kji_(1,T33,k,j,i);
+    const Real &mz_0 = trans_face1_kji_(1,T30,kf,jf,i);
+    const Real &mz_1 = trans_face1_kji_(1,T31,kf,jf,i);
+    const Real &mz_2 = trans_face1_kji_(1,T32,kf,jf,i);
+    const Real &mz_3 = trans_face1_kji_(1,T33,kf,jf,i);
 
     // Extract global projected 4-velocities
     Real uu1_l = prim_l(IVX,i);
@@ -841,38 +929,38 @@ void GRUser::PrimToLocal1(
     // Transform magnetic field if necessary
     if (MAGNETIC_FIELDS_ENABLED) {
       // Extract metric coefficients
-      const Real &g_00 = metric_face1_kji_(0,I00,k,j,i);
-      const Real &g_01 = metric_face1_kji_(0,I01,k,j,i);
-      const Real &g_02 = metric_face1_kji_(0,I02,k,j,i);
-      const Real &g_03 = metric_face1_kji_(0,I03,k,j,i);
-      const Real &g_10 = metric_face1_kji_(0,I01,k,j,i);
-      const Real &g_11 = metric_face1_kji_(0,I11,k,j,i);
-      const Real &g_12 = metric_face1_kji_(0,I12,k,j,i);
-      const Real &g_13 = metric_face1_kji_(0,I13,k,j,i);
-      const Real &g_20 = metric_face1_kji_(0,I02,k,j,i);
-      const Real &g_21 = metric_face1_kji_(0,I12,k,j,i);
-      const Real &g_22 = metric_face1_kji_(0,I22,k,j,i);
-      const Real &g_23 = metric_face1_kji_(0,I23,k,j,i);
-      const Real &g_30 = metric_face1_kji_(0,I03,k,j,i);
-      const Real &g_31 = metric_face1_kji_(0,I13,k,j,i);
-      const Real &g_32 = metric_face1_kji_(0,I23,k,j,i);
-      const Real &g_33 = metric_face1_kji_(0,I33,k,j,i);
-      const Real &g00 = metric_face1_kji_(1,I00,k,j,i);
-      const Real &g01 = metric_face1_kji_(1,I01,k,j,i);
-      const Real &g02 = metric_face1_kji_(1,I02,k,j,i);
-      const Real &g03 = metric_face1_kji_(1,I03,k,j,i);
-      const Real &g10 = metric_face1_kji_(1,I01,k,j,i);
-      const Real &g11 = metric_face1_kji_(1,I11,k,j,i);
-      const Real &g12 = metric_face1_kji_(1,I12,k,j,i);
-      const Real &g13 = metric_face1_kji_(1,I13,k,j,i);
-      const Real &g20 = metric_face1_kji_(1,I02,k,j,i);
-      const Real &g21 = metric_face1_kji_(1,I12,k,j,i);
-      const Real &g22 = metric_face1_kji_(1,I22,k,j,i);
-      const Real &g23 = metric_face1_kji_(1,I23,k,j,i);
-      const Real &g30 = metric_face1_kji_(1,I03,k,j,i);
-      const Real &g31 = metric_face1_kji_(1,I13,k,j,i);
-      const Real &g32 = metric_face1_kji_(1,I23,k,j,i);
-      const Real &g33 = metric_face1_kji_(1,I33,k,j,i);
+      const Real &g_00 = metric_face1_kji_(0,I00,kf,jf,i);
+      const Real &g_01 = metric_face1_kji_(0,I01,kf,jf,i);
+      const Real &g_02 = metric_face1_kji_(0,I02,kf,jf,i);
+      const Real &g_03 = metric_face1_kji_(0,I03,kf,jf,i);
+      const Real &g_10 = metric_face1_kji_(0,I01,kf,jf,i);
+      const Real &g_11 = metric_face1_kji_(0,I11,kf,jf,i);
+      const Real &g_12 = metric_face1_kji_(0,I12,kf,jf,i);
+      const Real &g_13 = metric_face1_kji_(0,I13,kf,jf,i);
+      const Real &g_20 = metric_face1_kji_(0,I02,kf,jf,i);
+      const Real &g_21 = metric_face1_kji_(0,I12,kf,jf,i);
+      const Real &g_22 = metric_face1_kji_(0,I22,kf,jf,i);
+      const Real &g_23 = metric_face1_kji_(0,I23,kf,jf,i);
+      const Real &g_30 = metric_face1_kji_(0,I03,kf,jf,i);
+      const Real &g_31 = metric_face1_kji_(0,I13,kf,jf,i);
+      const Real &g_32 = metric_face1_kji_(0,I23,kf,jf,i);
+      const Real &g_33 = metric_face1_kji_(0,I33,kf,jf,i);
+      const Real &g00 = metric_face1_kji_(1,I00,kf,jf,i);
+      const Real &g01 = metric_face1_kji_(1,I01,kf,jf,i);
+      const Real &g02 = metric_face1_kji_(1,I02,kf,jf,i);
+      const Real &g03 = metric_face1_kji_(1,I03,kf,jf,i);
+      const Real &g10 = metric_face1_kji_(1,I01,kf,jf,i);
+      const Real &g11 = metric_face1_kji_(1,I11,kf,jf,i);
+      const Real &g12 = metric_face1_kji_(1,I12,kf,jf,i);
+      const Real &g13 = metric_face1_kji_(1,I13,kf,jf,i);
+      const Real &g20 = metric_face1_kji_(1,I02,kf,jf,i);
+      const Real &g21 = metric_face1_kji_(1,I12,kf,jf,i);
+      const Real &g22 = metric_face1_kji_(1,I22,kf,jf,i);
+      const Real &g23 = metric_face1_kji_(1,I23,kf,jf,i);
+      const Real &g30 = metric_face1_kji_(1,I03,kf,jf,i);
+      const Real &g31 = metric_face1_kji_(1,I13,kf,jf,i);
+      const Real &g32 = metric_face1_kji_(1,I23,kf,jf,i);
+      const Real &g33 = metric_face1_kji_(1,I33,kf,jf,i);
       Real alpha = std::sqrt(-1.0/g00);
 
       // Calculate global 4-velocities
@@ -967,23 +1055,30 @@ void GRUser::PrimToLocal2(
     const int k, const int j, const int il, const int iu,
     const AthenaArray<Real> &bb2, AthenaArray<Real> &prim_l, AthenaArray<Real> &prim_r,
     AthenaArray<Real> &bbx) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(2, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   // Go through 1D block of cells
 #pragma omp simd
   for (int i=il; i<=iu; ++i) {
     // Extract transformation coefficients
-    const Real &mt_0 = trans_face2_kji_(1,T00,k,j,i);
-    const Real &mx_0 = trans_face2_kji_(1,T10,k,j,i);
+    const Real &mt_0 = trans_face2_kji_(1,T00,kf,jf,i);
+    const Real &mx_0 = trans_face2_kji_(1,T10,kf,jf,i);
     Real mx_1 = 0.0;
-    const Real &mx_2 = trans_face2_kji_(1,T11,k,j,i);
+    const Real &mx_2 = trans_face2_kji_(1,T11,kf,jf,i);
     Real mx_3 = 0.0;
-    const Real &my_0 = trans_face2_kji_(1,T20,k,j,i);
+    const Real &my_0 = trans_face2_kji_(1,T20,kf,jf,i);
     Real my_1 = 0.0;
-    const Real &my_2 = trans_face2_kji_(1,T21,k,j,i);
-    const Real &my_3 = trans_face2_kji_(1,T22,k,j,i);
-    const Real &mz_0 = trans_face2_kji_(1,T30,k,j,i);
-    const Real &mz_1 = trans_face2_kji_(1,T33,k,j,i);
-    const Real &mz_2 = trans_face2_kji_(1,T31,k,j,i);
-    const Real &mz_3 = trans_face2_kji_(1,T32,k,j,i);
+    const Real &my_2 = trans_face2_kji_(1,T21,kf,jf,i);
+    const Real &my_3 = trans_face2_kji_(1,T22,kf,jf,i);
+    const Real &mz_0 = trans_face2_kji_(1,T30,kf,jf,i);
+    const Real &mz_1 = trans_face2_kji_(1,T33,kf,jf,i);
+    const Real &mz_2 = trans_face2_kji_(1,T31,kf,jf,i);
+    const Real &mz_3 = trans_face2_kji_(1,T32,kf,jf,i);
 
     // Extract global projected 4-velocities
     Real uu1_l = prim_l(IVX,i);
@@ -1012,38 +1107,38 @@ void GRUser::PrimToLocal2(
     // Transform magnetic field if necessary
     if (MAGNETIC_FIELDS_ENABLED) {
       // Extract metric coefficients
-      const Real &g_00 = metric_face2_kji_(0,I00,k,j,i);
-      const Real &g_01 = metric_face2_kji_(0,I01,k,j,i);
-      const Real &g_02 = metric_face2_kji_(0,I02,k,j,i);
-      const Real &g_03 = metric_face2_kji_(0,I03,k,j,i);
-      const Real &g_10 = metric_face2_kji_(0,I01,k,j,i);
-      const Real &g_11 = metric_face2_kji_(0,I11,k,j,i);
-      const Real &g_12 = metric_face2_kji_(0,I12,k,j,i);
-      const Real &g_13 = metric_face2_kji_(0,I13,k,j,i);
-      const Real &g_20 = metric_face2_kji_(0,I02,k,j,i);
-      const Real &g_21 = metric_face2_kji_(0,I12,k,j,i);
-      const Real &g_22 = metric_face2_kji_(0,I22,k,j,i);
-      const Real &g_23 = metric_face2_kji_(0,I23,k,j,i);
-      const Real &g_30 = metric_face2_kji_(0,I03,k,j,i);
-      const Real &g_31 = metric_face2_kji_(0,I13,k,j,i);
-      const Real &g_32 = metric_face2_kji_(0,I23,k,j,i);
-      const Real &g_33 = metric_face2_kji_(0,I33,k,j,i);
-      const Real &g00 = metric_face2_kji_(1,I00,k,j,i);
-      const Real &g01 = metric_face2_kji_(1,I01,k,j,i);
-      const Real &g02 = metric_face2_kji_(1,I02,k,j,i);
-      const Real &g03 = metric_face2_kji_(1,I03,k,j,i);
-      const Real &g10 = metric_face2_kji_(1,I01,k,j,i);
-      const Real &g11 = metric_face2_kji_(1,I11,k,j,i);
-      const Real &g12 = metric_face2_kji_(1,I12,k,j,i);
-      const Real &g13 = metric_face2_kji_(1,I13,k,j,i);
-      const Real &g20 = metric_face2_kji_(1,I02,k,j,i);
-      const Real &g21 = metric_face2_kji_(1,I12,k,j,i);
-      const Real &g22 = metric_face2_kji_(1,I22,k,j,i);
-      const Real &g23 = metric_face2_kji_(1,I23,k,j,i);
-      const Real &g30 = metric_face2_kji_(1,I03,k,j,i);
-      const Real &g31 = metric_face2_kji_(1,I13,k,j,i);
-      const Real &g32 = metric_face2_kji_(1,I23,k,j,i);
-      const Real &g33 = metric_face2_kji_(1,I33,k,j,i);
+      const Real &g_00 = metric_face2_kji_(0,I00,kf,jf,i);
+      const Real &g_01 = metric_face2_kji_(0,I01,kf,jf,i);
+      const Real &g_02 = metric_face2_kji_(0,I02,kf,jf,i);
+      const Real &g_03 = metric_face2_kji_(0,I03,kf,jf,i);
+      const Real &g_10 = metric_face2_kji_(0,I01,kf,jf,i);
+      const Real &g_11 = metric_face2_kji_(0,I11,kf,jf,i);
+      const Real &g_12 = metric_face2_kji_(0,I12,kf,jf,i);
+      const Real &g_13 = metric_face2_kji_(0,I13,kf,jf,i);
+      const Real &g_20 = metric_face2_kji_(0,I02,kf,jf,i);
+      const Real &g_21 = metric_face2_kji_(0,I12,kf,jf,i);
+      const Real &g_22 = metric_face2_kji_(0,I22,kf,jf,i);
+      const Real &g_23 = metric_face2_kji_(0,I23,kf,jf,i);
+      const Real &g_30 = metric_face2_kji_(0,I03,kf,jf,i);
+      const Real &g_31 = metric_face2_kji_(0,I13,kf,jf,i);
+      const Real &g_32 = metric_face2_kji_(0,I23,kf,jf,i);
+      const Real &g_33 = metric_face2_kji_(0,I33,kf,jf,i);
+      const Real &g00 = metric_face2_kji_(1,I00,kf,jf,i);
+      const Real &g01 = metric_face2_kji_(1,I01,kf,jf,i);
+      const Real &g02 = metric_face2_kji_(1,I02,kf,jf,i);
+      const Real &g03 = metric_face2_kji_(1,I03,kf,jf,i);
+      const Real &g10 = metric_face2_kji_(1,I01,kf,jf,i);
+      const Real &g11 = metric_face2_kji_(1,I11,kf,jf,i);
+      const Real &g12 = metric_face2_kji_(1,I12,kf,jf,i);
+      const Real &g13 = metric_face2_kji_(1,I13,kf,jf,i);
+      const Real &g20 = metric_face2_kji_(1,I02,kf,jf,i);
+      const Real &g21 = metric_face2_kji_(1,I12,kf,jf,i);
+      const Real &g22 = metric_face2_kji_(1,I22,kf,jf,i);
+      const Real &g23 = metric_face2_kji_(1,I23,kf,jf,i);
+      const Real &g30 = metric_face2_kji_(1,I03,kf,jf,i);
+      const Real &g31 = metric_face2_kji_(1,I13,kf,jf,i);
+      const Real &g32 = metric_face2_kji_(1,I23,kf,jf,i);
+      const Real &g33 = metric_face2_kji_(1,I33,kf,jf,i);
       Real alpha = std::sqrt(-1.0/g00);
 
       // Calculate global 4-velocities
@@ -1138,23 +1233,30 @@ void GRUser::PrimToLocal3(
     const int k, const int j, const int il, const int iu,
     const AthenaArray<Real> &bb3, AthenaArray<Real> &prim_l, AthenaArray<Real> &prim_r,
     AthenaArray<Real> &bbx) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(3, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   // Go through 1D block of cells
 #pragma omp simd
   for (int i=il; i<=iu; ++i) {
     // Extract transformation coefficients
-    const Real &mt_0 = trans_face3_kji_(1,T00,k,j,i);
-    const Real &mx_0 = trans_face3_kji_(1,T10,k,j,i);
+    const Real &mt_0 = trans_face3_kji_(1,T00,kf,jf,i);
+    const Real &mx_0 = trans_face3_kji_(1,T10,kf,jf,i);
     Real mx_1 = 0.0;
     Real mx_2 = 0.0;
-    const Real &mx_3 = trans_face3_kji_(1,T11,k,j,i);
-    const Real &my_0 = trans_face3_kji_(1,T20,k,j,i);
-    const Real &my_1 = trans_face3_kji_(1,T22,k,j,i);
+    const Real &mx_3 = trans_face3_kji_(1,T11,kf,jf,i);
+    const Real &my_0 = trans_face3_kji_(1,T20,kf,jf,i);
+    const Real &my_1 = trans_face3_kji_(1,T22,kf,jf,i);
     Real my_2 = 0.0;
-    const Real &my_3 = trans_face3_kji_(1,T21,k,j,i);
-    const Real &mz_0 = trans_face3_kji_(1,T30,k,j,i);
-    const Real &mz_1 = trans_face3_kji_(1,T32,k,j,i);
-    const Real &mz_2 = trans_face3_kji_(1,T33,k,j,i);
-    const Real &mz_3 = trans_face3_kji_(1,T31,k,j,i);
+    const Real &my_3 = trans_face3_kji_(1,T21,kf,jf,i);
+    const Real &mz_0 = trans_face3_kji_(1,T30,kf,jf,i);
+    const Real &mz_1 = trans_face3_kji_(1,T32,kf,jf,i);
+    const Real &mz_2 = trans_face3_kji_(1,T33,kf,jf,i);
+    const Real &mz_3 = trans_face3_kji_(1,T31,kf,jf,i);
 
     // Extract global projected 4-velocities
     Real uu1_l = prim_l(IVX,i);
@@ -1183,38 +1285,38 @@ void GRUser::PrimToLocal3(
     // Transform magnetic field if necessary
     if (MAGNETIC_FIELDS_ENABLED) {
       // Extract metric coefficients
-      const Real &g_00 = metric_face3_kji_(0,I00,k,j,i);
-      const Real &g_01 = metric_face3_kji_(0,I01,k,j,i);
-      const Real &g_02 = metric_face3_kji_(0,I02,k,j,i);
-      const Real &g_03 = metric_face3_kji_(0,I03,k,j,i);
-      const Real &g_10 = metric_face3_kji_(0,I01,k,j,i);
-      const Real &g_11 = metric_face3_kji_(0,I11,k,j,i);
-      const Real &g_12 = metric_face3_kji_(0,I12,k,j,i);
-      const Real &g_13 = metric_face3_kji_(0,I13,k,j,i);
-      const Real &g_20 = metric_face3_kji_(0,I02,k,j,i);
-      const Real &g_21 = metric_face3_kji_(0,I12,k,j,i);
-      const Real &g_22 = metric_face3_kji_(0,I22,k,j,i);
-      const Real &g_23 = metric_face3_kji_(0,I23,k,j,i);
-      const Real &g_30 = metric_face3_kji_(0,I03,k,j,i);
-      const Real &g_31 = metric_face3_kji_(0,I13,k,j,i);
-      const Real &g_32 = metric_face3_kji_(0,I23,k,j,i);
-      const Real &g_33 = metric_face3_kji_(0,I33,k,j,i);
-      const Real &g00 = metric_face3_kji_(1,I00,k,j,i);
-      const Real &g01 = metric_face3_kji_(1,I01,k,j,i);
-      const Real &g02 = metric_face3_kji_(1,I02,k,j,i);
-      const Real &g03 = metric_face3_kji_(1,I03,k,j,i);
-      const Real &g10 = metric_face3_kji_(1,I01,k,j,i);
-      const Real &g11 = metric_face3_kji_(1,I11,k,j,i);
-      const Real &g12 = metric_face3_kji_(1,I12,k,j,i);
-      const Real &g13 = metric_face3_kji_(1,I13,k,j,i);
-      const Real &g20 = metric_face3_kji_(1,I02,k,j,i);
-      const Real &g21 = metric_face3_kji_(1,I12,k,j,i);
-      const Real &g22 = metric_face3_kji_(1,I22,k,j,i);
-      const Real &g23 = metric_face3_kji_(1,I23,k,j,i);
-      const Real &g30 = metric_face3_kji_(1,I03,k,j,i);
-      const Real &g31 = metric_face3_kji_(1,I13,k,j,i);
-      const Real &g32 = metric_face3_kji_(1,I23,k,j,i);
-      const Real &g33 = metric_face3_kji_(1,I33,k,j,i);
+      const Real &g_00 = metric_face3_kji_(0,I00,kf,jf,i);
+      const Real &g_01 = metric_face3_kji_(0,I01,kf,jf,i);
+      const Real &g_02 = metric_face3_kji_(0,I02,kf,jf,i);
+      const Real &g_03 = metric_face3_kji_(0,I03,kf,jf,i);
+      const Real &g_10 = metric_face3_kji_(0,I01,kf,jf,i);
+      const Real &g_11 = metric_face3_kji_(0,I11,kf,jf,i);
+      const Real &g_12 = metric_face3_kji_(0,I12,kf,jf,i);
+      const Real &g_13 = metric_face3_kji_(0,I13,kf,jf,i);
+      const Real &g_20 = metric_face3_kji_(0,I02,kf,jf,i);
+      const Real &g_21 = metric_face3_kji_(0,I12,kf,jf,i);
+      const Real &g_22 = metric_face3_kji_(0,I22,kf,jf,i);
+      const Real &g_23 = metric_face3_kji_(0,I23,kf,jf,i);
+      const Real &g_30 = metric_face3_kji_(0,I03,kf,jf,i);
+      const Real &g_31 = metric_face3_kji_(0,I13,kf,jf,i);
+      const Real &g_32 = metric_face3_kji_(0,I23,kf,jf,i);
+      const Real &g_33 = metric_face3_kji_(0,I33,kf,jf,i);
+      const Real &g00 = metric_face3_kji_(1,I00,kf,jf,i);
+      const Real &g01 = metric_face3_kji_(1,I01,kf,jf,i);
+      const Real &g02 = metric_face3_kji_(1,I02,kf,jf,i);
+      const Real &g03 = metric_face3_kji_(1,I03,kf,jf,i);
+      const Real &g10 = metric_face3_kji_(1,I01,kf,jf,i);
+      const Real &g11 = metric_face3_kji_(1,I11,kf,jf,i);
+      const Real &g12 = metric_face3_kji_(1,I12,kf,jf,i);
+      const Real &g13 = metric_face3_kji_(1,I13,kf,jf,i);
+      const Real &g20 = metric_face3_kji_(1,I02,kf,jf,i);
+      const Real &g21 = metric_face3_kji_(1,I12,kf,jf,i);
+      const Real &g22 = metric_face3_kji_(1,I22,kf,jf,i);
+      const Real &g23 = metric_face3_kji_(1,I23,kf,jf,i);
+      const Real &g30 = metric_face3_kji_(1,I03,kf,jf,i);
+      const Real &g31 = metric_face3_kji_(1,I13,kf,jf,i);
+      const Real &g32 = metric_face3_kji_(1,I23,kf,jf,i);
+      const Real &g33 = metric_face3_kji_(1,I33,kf,jf,i);
       Real alpha = std::sqrt(-1.0/g00);
 
       // Calculate global 4-velocities
@@ -1306,20 +1408,27 @@ void GRUser::FluxToGlobal1(
     const int k, const int j, const int il, const int iu,
     const AthenaArray<Real> &cons, const AthenaArray<Real> &bbx, AthenaArray<Real> &flux,
     AthenaArray<Real> &ey, AthenaArray<Real> &ez) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(1, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   // Go through 1D block of cells
 #pragma omp simd
   for (int i=il; i<=iu; ++i) {
     // Extract transformation coefficients
-    const Real &m0_tm = trans_face1_kji_(0,T00,k,j,i);
-    const Real &m1_tm = trans_face1_kji_(0,T10,k,j,i);
-    const Real &m1_x = trans_face1_kji_(0,T11,k,j,i);
-    const Real &m2_tm = trans_face1_kji_(0,T20,k,j,i);
-    const Real &m2_x = trans_face1_kji_(0,T21,k,j,i);
-    const Real &m2_y = trans_face1_kji_(0,T22,k,j,i);
-    const Real &m3_tm = trans_face1_kji_(0,T30,k,j,i);
-    const Real &m3_x = trans_face1_kji_(0,T31,k,j,i);
-    const Real &m3_y = trans_face1_kji_(0,T32,k,j,i);
-    const Real &m3_z = trans_face1_kji_(0,T33,k,j,i);
+    const Real &m0_tm = trans_face1_kji_(0,T00,kf,jf,i);
+    const Real &m1_tm = trans_face1_kji_(0,T10,kf,jf,i);
+    const Real &m1_x = trans_face1_kji_(0,T11,kf,jf,i);
+    const Real &m2_tm = trans_face1_kji_(0,T20,kf,jf,i);
+    const Real &m2_x = trans_face1_kji_(0,T21,kf,jf,i);
+    const Real &m2_y = trans_face1_kji_(0,T22,kf,jf,i);
+    const Real &m3_tm = trans_face1_kji_(0,T30,kf,jf,i);
+    const Real &m3_x = trans_face1_kji_(0,T31,kf,jf,i);
+    const Real &m3_y = trans_face1_kji_(0,T32,kf,jf,i);
+    const Real &m3_z = trans_face1_kji_(0,T33,kf,jf,i);
 
     // Extract local conserved quantities and fluxes
     Real jt = cons(IDN,i);
@@ -1344,22 +1453,22 @@ void GRUser::FluxToGlobal1(
                + m1_x * (m3_tm*txt + m3_x*txx + m3_y*txy + m3_z*txz);
 
     // Extract metric coefficients
-    const Real &g_00 = metric_face1_kji_(0,I00,k,j,i);
-    const Real &g_01 = metric_face1_kji_(0,I01,k,j,i);
-    const Real &g_02 = metric_face1_kji_(0,I02,k,j,i);
-    const Real &g_03 = metric_face1_kji_(0,I03,k,j,i);
-    const Real &g_10 = metric_face1_kji_(0,I01,k,j,i);
-    const Real &g_11 = metric_face1_kji_(0,I11,k,j,i);
-    const Real &g_12 = metric_face1_kji_(0,I12,k,j,i);
-    const Real &g_13 = metric_face1_kji_(0,I13,k,j,i);
-    const Real &g_20 = metric_face1_kji_(0,I02,k,j,i);
-    const Real &g_21 = metric_face1_kji_(0,I12,k,j,i);
-    const Real &g_22 = metric_face1_kji_(0,I22,k,j,i);
-    const Real &g_23 = metric_face1_kji_(0,I23,k,j,i);
-    const Real &g_30 = metric_face1_kji_(0,I03,k,j,i);
-    const Real &g_31 = metric_face1_kji_(0,I13,k,j,i);
-    const Real &g_32 = metric_face1_kji_(0,I23,k,j,i);
-    const Real &g_33 = metric_face1_kji_(0,I33,k,j,i);
+    const Real &g_00 = metric_face1_kji_(0,I00,kf,jf,i);
+    const Real &g_01 = metric_face1_kji_(0,I01,kf,jf,i);
+    const Real &g_02 = metric_face1_kji_(0,I02,kf,jf,i);
+    const Real &g_03 = metric_face1_kji_(0,I03,kf,jf,i);
+    const Real &g_10 = metric_face1_kji_(0,I01,kf,jf,i);
+    const Real &g_11 = metric_face1_kji_(0,I11,kf,jf,i);
+    const Real &g_12 = metric_face1_kji_(0,I12,kf,jf,i);
+    const Real &g_13 = metric_face1_kji_(0,I13,kf,jf,i);
+    const Real &g_20 = metric_face1_kji_(0,I02,kf,jf,i);
+    const Real &g_21 = metric_face1_kji_(0,I12,kf,jf,i);
+    const Real &g_22 = metric_face1_kji_(0,I22,kf,jf,i);
+    const Real &g_23 = metric_face1_kji_(0,I23,kf,jf,i);
+    const Real &g_30 = metric_face1_kji_(0,I03,kf,jf,i);
+    const Real &g_31 = metric_face1_kji_(0,I13,kf,jf,i);
+    const Real &g_32 = metric_face1_kji_(0,I23,kf,jf,i);
+    const Real &g_33 = metric_face1_kji_(0,I33,kf,jf,i);
 
     // Extract global fluxes
     Real &j1 = flux(IDN,k,j,i);
@@ -1418,20 +1527,27 @@ void GRUser::FluxToGlobal2(
     const int k, const int j, const int il, const int iu,
     const AthenaArray<Real> &cons, const AthenaArray<Real> &bbx, AthenaArray<Real> &flux,
     AthenaArray<Real> &ey, AthenaArray<Real> &ez) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(2, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   // Go through 1D block of cells
 #pragma omp simd
   for (int i=il; i<=iu; ++i) {
     // Extract transformation coefficients
-    const Real &m0_tm = trans_face2_kji_(0,T00,k,j,i);
-    const Real &m1_tm = trans_face2_kji_(0,T30,k,j,i);
-    const Real &m1_x = trans_face2_kji_(0,T31,k,j,i);
-    const Real &m1_y = trans_face2_kji_(0,T32,k,j,i);
-    const Real &m1_z = trans_face2_kji_(0,T33,k,j,i);
-    const Real &m2_tm = trans_face2_kji_(0,T10,k,j,i);
-    const Real &m2_x = trans_face2_kji_(0,T11,k,j,i);
-    const Real &m3_tm = trans_face2_kji_(0,T20,k,j,i);
-    const Real &m3_x = trans_face2_kji_(0,T21,k,j,i);
-    const Real &m3_y = trans_face2_kji_(0,T22,k,j,i);
+    const Real &m0_tm = trans_face2_kji_(0,T00,kf,jf,i);
+    const Real &m1_tm = trans_face2_kji_(0,T30,kf,jf,i);
+    const Real &m1_x = trans_face2_kji_(0,T31,kf,jf,i);
+    const Real &m1_y = trans_face2_kji_(0,T32,kf,jf,i);
+    const Real &m1_z = trans_face2_kji_(0,T33,kf,jf,i);
+    const Real &m2_tm = trans_face2_kji_(0,T10,kf,jf,i);
+    const Real &m2_x = trans_face2_kji_(0,T11,kf,jf,i);
+    const Real &m3_tm = trans_face2_kji_(0,T20,kf,jf,i);
+    const Real &m3_x = trans_face2_kji_(0,T21,kf,jf,i);
+    const Real &m3_y = trans_face2_kji_(0,T22,kf,jf,i);
 
     // Extract local conserved quantities and fluxes
     Real jt = cons(IDN,i);
@@ -1456,22 +1572,22 @@ void GRUser::FluxToGlobal2(
                + m2_x * (m3_tm*txt + m3_x*txx + m3_y*txy);
 
     // Extract metric coefficients
-    const Real &g_00 = metric_face2_kji_(0,I00,k,j,i);
-    const Real &g_01 = metric_face2_kji_(0,I01,k,j,i);
-    const Real &g_02 = metric_face2_kji_(0,I02,k,j,i);
-    const Real &g_03 = metric_face2_kji_(0,I03,k,j,i);
-    const Real &g_10 = metric_face2_kji_(0,I01,k,j,i);
-    const Real &g_11 = metric_face2_kji_(0,I11,k,j,i);
-    const Real &g_12 = metric_face2_kji_(0,I12,k,j,i);
-    const Real &g_13 = metric_face2_kji_(0,I13,k,j,i);
-    const Real &g_20 = metric_face2_kji_(0,I02,k,j,i);
-    const Real &g_21 = metric_face2_kji_(0,I12,k,j,i);
-    const Real &g_22 = metric_face2_kji_(0,I22,k,j,i);
-    const Real &g_23 = metric_face2_kji_(0,I23,k,j,i);
-    const Real &g_30 = metric_face2_kji_(0,I03,k,j,i);
-    const Real &g_31 = metric_face2_kji_(0,I13,k,j,i);
-    const Real &g_32 = metric_face2_kji_(0,I23,k,j,i);
-    const Real &g_33 = metric_face2_kji_(0,I33,k,j,i);
+    const Real &g_00 = metric_face2_kji_(0,I00,kf,jf,i);
+    const Real &g_01 = metric_face2_kji_(0,I01,kf,jf,i);
+    const Real &g_02 = metric_face2_kji_(0,I02,kf,jf,i);
+    const Real &g_03 = metric_face2_kji_(0,I03,kf,jf,i);
+    const Real &g_10 = metric_face2_kji_(0,I01,kf,jf,i);
+    const Real &g_11 = metric_face2_kji_(0,I11,kf,jf,i);
+    const Real &g_12 = metric_face2_kji_(0,I12,kf,jf,i);
+    const Real &g_13 = metric_face2_kji_(0,I13,kf,jf,i);
+    const Real &g_20 = metric_face2_kji_(0,I02,kf,jf,i);
+    const Real &g_21 = metric_face2_kji_(0,I12,kf,jf,i);
+    const Real &g_22 = metric_face2_kji_(0,I22,kf,jf,i);
+    const Real &g_23 = metric_face2_kji_(0,I23,kf,jf,i);
+    const Real &g_30 = metric_face2_kji_(0,I03,kf,jf,i);
+    const Real &g_31 = metric_face2_kji_(0,I13,kf,jf,i);
+    const Real &g_32 = metric_face2_kji_(0,I23,kf,jf,i);
+    const Real &g_33 = metric_face2_kji_(0,I33,kf,jf,i);
 
     // Extract global fluxes
     Real &j2 = flux(IDN,k,j,i);
@@ -1530,20 +1646,27 @@ void GRUser::FluxToGlobal3(
     const int k, const int j, const int il, const int iu,
     const AthenaArray<Real> &cons, const AthenaArray<Real> &bbx, AthenaArray<Real> &flux,
     AthenaArray<Real> &ey, AthenaArray<Real> &ez) {
+  // face-centered metric and transformation, stored or recomputed
+  int kf = k, jf = j;
+  if (!metric_cached_) {
+    FacePencil(3, k, j, il, iu);
+    kf = jf = 0;
+  }
+
   // Go through 1D block of cells
 #pragma omp simd
   for (int i=il; i<=iu; ++i) {
     // Extract transformation coefficients
-    const Real &m0_tm = trans_face3_kji_(0,T00,k,j,i);
-    const Real &m1_tm = trans_face3_kji_(0,T20,k,j,i);
-    const Real &m1_x = trans_face3_kji_(0,T21,k,j,i);
-    const Real &m1_y = trans_face3_kji_(0,T22,k,j,i);
-    const Real &m2_tm = trans_face3_kji_(0,T30,k,j,i);
-    const Real &m2_x = trans_face3_kji_(0,T31,k,j,i);
-    const Real &m2_y = trans_face3_kji_(0,T32,k,j,i);
-    const Real &m2_z = trans_face3_kji_(0,T33,k,j,i);
-    const Real &m3_tm = trans_face3_kji_(0,T10,k,j,i);
-    const Real &m3_x = trans_face3_kji_(0,T11,k,j,i);
+    const Real &m0_tm = trans_face3_kji_(0,T00,kf,jf,i);
+    const Real &m1_tm = trans_face3_kji_(0,T20,kf,jf,i);
+    const Real &m1_x = trans_face3_kji_(0,T21,kf,jf,i);
+    const Real &m1_y = trans_face3_kji_(0,T22,kf,jf,i);
+    const Real &m2_tm = trans_face3_kji_(0,T30,kf,jf,i);
+    const Real &m2_x = trans_face3_kji_(0,T31,kf,jf,i);
+    const Real &m2_y = trans_face3_kji_(0,T32,kf,jf,i);
+    const Real &m2_z = trans_face3_kji_(0,T33,kf,jf,i);
+    const Real &m3_tm = trans_face3_kji_(0,T10,kf,jf,i);
+    const Real &m3_x = trans_face3_kji_(0,T11,kf,jf,i);
 
     // Extract local conserved quantities and fluxes
     Real jt = cons(IDN,i);
@@ -1568,22 +1691,22 @@ void GRUser::FluxToGlobal3(
                + m3_x * (m3_tm*txt + m3_x*txx);
 
     // Extract metric coefficients
-    const Real &g_00 = metric_face3_kji_(0,I00,k,j,i);
-    const Real &g_01 = metric_face3_kji_(0,I01,k,j,i);
-    const Real &g_02 = metric_face3_kji_(0,I02,k,j,i);
-    const Real &g_03 = metric_face3_kji_(0,I03,k,j,i);
-    const Real &g_10 = metric_face3_kji_(0,I01,k,j,i);
-    const Real &g_11 = metric_face3_kji_(0,I11,k,j,i);
-    const Real &g_12 = metric_face3_kji_(0,I12,k,j,i);
-    const Real &g_13 = metric_face3_kji_(0,I13,k,j,i);
-    const Real &g_20 = metric_face3_kji_(0,I02,k,j,i);
-    const Real &g_21 = metric_face3_kji_(0,I12,k,j,i);
-    const Real &g_22 = metric_face3_kji_(0,I22,k,j,i);
-    const Real &g_23 = metric_face3_kji_(0,I23,k,j,i);
-    const Real &g_30 = metric_face3_kji_(0,I03,k,j,i);
-    const Real &g_31 = metric_face3_kji_(0,I13,k,j,i);
-    const Real &g_32 = metric_face3_kji_(0,I23,k,j,i);
-    const Real &g_33 = metric_face3_kji_(0,I33,k,j,i);
+    const Real &g_00 = metric_face3_kji_(0,I00,kf,jf,i);
+    const Real &g_01 = metric_face3_kji_(0,I01,kf,jf,i);
+    const Real &g_02 = metric_face3_kji_(0,I02,kf,jf,i);
+    const Real &g_03 = metric_face3_kji_(0,I03,kf,jf,i);
+    const Real &g_10 = metric_face3_kji_(0,I01,kf,jf,i);
+    const Real &g_11 = metric_face3_kji_(0,I11,kf,jf,i);
+    const Real &g_12 = metric_face3_kji_(0,I12,kf,jf,i);
+    const Real &g_13 = metric_face3_kji_(0,I13,kf,jf,i);
+    const Real &g_20 = metric_face3_kji_(0,I02,kf,jf,i);
+    const Real &g_21 = metric_face3_kji_(0,I12,kf,jf,i);
+    const Real &g_22 = metric_face3_kji_(0,I22,kf,jf,i);
+    const Real &g_23 = metric_face3_kji_(0,I23,kf,jf,i);
+    const Real &g_30 = metric_face3_kji_(0,I03,kf,jf,i);
+    const Real &g_31 = metric_face3_kji_(0,I13,kf,jf,i);
+    const Real &g_32 = metric_face3_kji_(0,I23,kf,jf,i);
+    const Real &g_33 = metric_face3_kji_(0,I33,kf,jf,i);
 
     // Extract global fluxes
     Real &j3 = flux(IDN,k,j,i);
@@ -521,6 +521,9 @@ KerrSchild::KerrSchild(MeshBlock *pmb, ParameterInput *pin, bool flag)
       }
     }
   }
+
+  // Optionally store the metric, which does not depend on phi
+  CacheMetric(pin);
 }
 
 
@@ -882,6 +885,11 @@ void KerrSchild::AddCoordTermsDivergence(
 
 void KerrSchild::CellMetric(const int k, const int j, const int il, const int iu,
                             AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  if (metric_cached_) {
+    LoadMetric(metric_cell_ji_, j, il, iu, g, g_inv);
+    return;
+  }
+
   // Extract useful quantities that do not depend on r
   const Real &m = bh_mass_;
   const Real &a = bh_spin_;
@@ -929,6 +937,11 @@ void KerrSchild::CellMetric(const int k, const int j, const int il, const int iu
 
 void KerrSchild::Face1Metric(const int k, const int j, const int il, const int iu,
                              AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  if (metric_cached_) {
+    LoadMetric(metric_face1_ji_, j, il, iu, g, g_inv);
+    return;
+  }
+
   // Extract useful quantities that do not depend on r
   const Real &m = bh_mass_;
   const Real &a = bh_spin_;
@@ -976,6 +989,11 @@ void KerrSchild::Face1Metric(const int k, const int j, const int il, const int i
 
 void KerrSchild::Face2Metric(const int k, const int j, const int il, const int iu,
                              AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  if (metric_cached_) {
+    LoadMetric(metric_face2_ji_, j, il, iu, g, g_inv);
+    return;
+  }
+
   // Extract useful quantities that do not depend on r
   const Real &m = bh_mass_;
   const Real &a = bh_spin_;
@@ -1023,6 +1041,12 @@ void KerrSchild::Face2Metric(const int k, const int j, const int il, const int i
 
 void KerrSchild::Face3Metric(const int k, const int j, const int il, const int iu,
                              AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  // x3-faces have the metric of the cell centers
+  if (metric_cached_) {
+    LoadMetric(metric_cell_ji_, j, il, iu, g, g_inv);
+    return;
+  }
+
   // Extract useful quantities that do not depend on r
   const Real &m = bh_mass_;
   const Real &a = bh_spin_;
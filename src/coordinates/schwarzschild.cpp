@@ -285,6 +285,9 @@ Schwarzschild::Schwarzschild(MeshBlock *pmb, ParameterInput *pin, bool flag)
       trans_face3_j1_(j) = std::abs(sin_c);
     }
   }
+
+  // Optionally store the metric, which does not depend on phi
+  CacheMetric(pin);
 }
 
 
@@ -589,6 +592,11 @@ void Schwarzschild::AddCoordTermsDivergence(
 
 void Schwarzschild::CellMetric(const int k, const int j, const int il, const int iu,
                                AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  if (metric_cached_) {
+    LoadMetric(metric_cell_ji_, j, il, iu, g, g_inv);
+    return;
+  }
+
   // Extract geometric quantities that do not depend on r
   const Real &sin_sq_theta = metric_cell_j1_(j);
 
@@ -634,6 +642,11 @@ void Schwarzschild::CellMetric(const int k, const int j, const int il, const int
 
 void Schwarzschild::Face1Metric(const int k, const int j, const int il, const int iu,
                                 AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  if (metric_cached_) {
+    LoadMetric(metric_face1_ji_, j, il, iu, g, g_inv);
+    return;
+  }
+
   // Extract geometric quantities that do not depend on r
   const Real &sin_sq_theta = metric_face1_j1_(j);
 
@@ -679,6 +692,11 @@ void Schwarzschild::Face1Metric(const int k, const int j, const int il, const in
 
 void Schwarzschild::Face2Metric(const int k, const int j, const int il, const int iu,
                                 AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  if (metric_cached_) {
+    LoadMetric(metric_face2_ji_, j, il, iu, g, g_inv);
+    return;
+  }
+
   // Extract geometric quantities that do not depend on r
   const Real &sin_sq_theta = metric_face2_j1_(j);
 
@@ -724,6 +742,12 @@ void Schwarzschild::Face2Metric(const int k, const int j, const int il, const in
 
 void Schwarzschild::Face3Metric(const int k, const int j, const int il, const int iu,
                                 AthenaArray<Real> &g, AthenaArray<Real> &g_inv) {
+  // x3-faces have the metric of the cell centers
+  if (metric_cached_) {
+    LoadMetric(metric_cell_ji_, j, il, iu, g, g_inv);
+    return;
+  }
+
   // Extract geometric quantities that do not depend on r
   const Real &sin_sq_theta = metric_face3_j1_(j);
 
@@ -12,6 +12,7 @@
 // C++ headers
 #include <algorithm>  // max, min
 #include <cmath>      // abs, acos, cbrt, cos, isfinite, pow, sqrt
+#include <cstdint>    // int64_t
 
 // Athena++ headers
 #include "../athena.hpp"                   // enums, macros
@@ -32,8 +33,19 @@ void CalculateNormalConserved(
 bool ConservedToPrimitiveNormal(
     const AthenaArray<Real> &dd_vals, const AthenaArray<Real> &ee_vals,
     const AthenaArray<Real> &mm_vals, const AthenaArray<Real> &bb_vals,
-    const AthenaArray<Real> &tt_vals, Real gamma_adi, Real pgas_old, int k, int j, int i,
-    AthenaArray<Real> &prim, Real *p_gamma_lor, Real *p_pmag);
+    const AthenaArray<Real> &tt_vals, Real gamma_adi, Real pgas_old, int max_iterations,
+    int k, int j, int i, AthenaArray<Real> &prim, Real *p_gamma_lor, Real *p_pmag,
+    int *p_iterations);
+int IteratePressure(Real dd, Real ee, Real mm_sq, Real bb_sq, Real tt, Real d,
+                    Real pgas_min, Real gamma_adi, int n_start, int max_iterations,
+                    Real pgas[3]);
+void ConservedToPrimitiveNormalRow(
+    const AthenaArray<Real> &dd_vals, const AthenaArray<Real> &ee_vals,
+    const AthenaArray<Real> &mm_vals, const AthenaArray<Real> &bb_vals,
+    const AthenaArray<Real> &tt_vals, Real gamma_adi, const AthenaArray<Real> &prim_old,
+    int k, int j, int il, int iu, AthenaArray<int> &lane, AthenaArray<Real> &scratch,
+    AthenaArray<Real> &prim, std::int64_t *p_iterations, std::int64_t *p_fallbacks,
+    std::int64_t *p_failures);
 void PrimitiveToConservedSingle(
     const AthenaArray<Real> &prim, Real gamma_adi, const AthenaArray<Real> &bb_cc,
     const AthenaArray<Real> &g, const AthenaArray<Real> &gi, int k, int j, int i,
@@ -67,6 +79,8 @@ EquationOfState::EquationOfState(MeshBlock *pmb, ParameterInput *pin) :
   normal_mm_.NewAthenaArray(4,nc1);
   normal_bb_.NewAthenaArray(4,nc1);
   normal_tt_.NewAthenaArray(nc1);
+  c2p_scratch_.NewAthenaArray(9,nc1);
+  c2p_lane_.NewAthenaArray(4,nc1);
 }
 
 //----------------------------------------------------------------------------------------
@@ -83,6 +97,8 @@ EquationOfState::EquationOfState(MeshBlock *pmb, ParameterInput *pin) :
 // Notes:
 //   Simpler version without magnetic fields found in adiabatic_hydro_gr.cpp.
 //   Simpler version for SR found in adiabatic_mhd_sr.cpp.
+//   Each row of cells is inverted together, see ConservedToPrimitiveNormalRow(), and the
+//       iterations, fallbacks, and failures are added to the c2p_* counters.
 
 void EquationOfState::ConservedToPrimitive(
     AthenaArray<Real> &cons, const AthenaArray<Real> &prim_old, const FaceField &bb,
@@ -107,7 +123,7 @@ void EquationOfState::ConservedToPrimitive(
       CalculateNormalConserved(cons, bb_cc, g_, g_inv_, k, j, il, iu, normal_dd_,
                                normal_ee_, normal_mm_, normal_bb_, normal_tt_);
 
-      // Go through cells
+      // Go through cells, adjusting normal-frame conserved values
       for (int i=il; i<=iu; ++i) {
         // Set flag indicating conserved values need adjusting at end
         bool fixed = false;
@@ -150,23 +166,37 @@ void EquationOfState::ConservedToPrimitive(
           normal_tt_(i) *= factor;
           fixed = true;
         }
+        c2p_scratch_(7,i) = density_floor_local;
+        c2p_scratch_(8,i) = pressure_floor_local;
+        c2p_lane_(0,i) = 1;
+        c2p_lane_(2,i) = fixed;
+      }
 
-        // Set primitives
-        Real gamma, pmag;
-        bool success = ConservedToPrimitiveNormal(normal_dd_, normal_ee_, normal_mm_,
-                                                  normal_bb_, normal_tt_, gamma_adi,
-                                                  prim_old(IPR,k,j,i), k, j, i, prim,
-                                                  &gamma, &pmag);
+      // Set primitives in all cells
+      ConservedToPrimitiveNormalRow(normal_dd_, normal_ee_, normal_mm_, normal_bb_,
+                                    normal_tt_, gamma_adi, prim_old, k, j, il, iu,
+                                    c2p_lane_, c2p_scratch_, prim, &c2p_iterations,
+                                    &c2p_fallbacks, &c2p_failures);
+
+      // Go through cells, applying floors in normal frame
+      for (int i=il; i<=iu; ++i) {
+        bool success = c2p_lane_(0,i);
+        bool fixed = c2p_lane_(2,i);
+        Real &gamma = c2p_scratch_(5,i);
+        Real &pmag = c2p_scratch_(6,i);
 
         // Handle failures
         if (!success) {
           for (int n = 0; n < NHYDRO; ++n) {
             prim(n,k,j,i) = prim_old(n,k,j,i);
           }
+          pmag = 0.0;
           fixed = true;
         }
 
         // Apply density and gas pressure floors in normal frame
+        Real density_floor_local = c2p_scratch_(7,i);
+        Real pressure_floor_local = c2p_scratch_(8,i);
         if (sigma_max_ > 0.0) {
           density_floor_local = std::max(density_floor_local, 2.0*pmag/sigma_max_);
         }
@@ -177,25 +207,38 @@ void EquationOfState::ConservedToPrimitive(
                                                 static_cast<Real>(0.0));
         Real pgas_add = std::max(pressure_floor_local-prim(IPR,k,j,i),
                                                 static_cast<Real>(0.0));
+        c2p_lane_(0,i) = 0;
         if (success && (rho_add > 0.0 || pgas_add > 0.0)) {
-          // Adjust conserved density and energy
+          // Adjust conserved density and energy, marking cell for recalculation
           Real wgas_add = rho_add + gamma_adi/(gamma_adi-1.0) * pgas_add;
           normal_dd_(i) += rho_add * gamma;
           normal_ee_(i) += wgas_add * SQR(gamma) + pgas_add;
+          c2p_lane_(0,i) = 1;
+          fixed = true;
+        }
+        c2p_lane_(2,i) = fixed;
+        c2p_lane_(3,i) = success;
+      }
 
-          // Recalculate primitives
-          success = ConservedToPrimitiveNormal(normal_dd_, normal_ee_, normal_mm_,
-                                               normal_bb_, normal_tt_, gamma_adi,
-                                               prim_old(IPR,k,j,i), k, j, i, prim, &gamma,
-                                               &pmag);
-
-          // Handle failures
-          if (!success) {
-            for (int n = 0; n < NHYDRO; ++n) {
-              prim(n,k,j,i) = prim_old(n,k,j,i);
-            }
+      // Recalculate primitives where floors were applied
+      ConservedToPrimitiveNormalRow(normal_dd_, normal_ee_, normal_mm_, normal_bb_,
+                                    normal_tt_, gamma_adi, prim_old, k, j, il, iu,
+                                    c2p_lane_, c2p_scratch_, prim, &c2p_iterations,
+                                    &c2p_fallbacks, &c2p_failures);
+
+      // Go through cells, applying ceilings and floors in fluid frame
+      for (int i=il; i<=iu; ++i) {
+        bool success = c2p_lane_(3,i);
+        bool fixed = c2p_lane_(2,i);
+        Real gamma = c2p_scratch_(5,i);
+        Real pmag = c2p_scratch_(6,i);
+
+        // Handle failures of recalculation
+        if (c2p_lane_(1,i) >= 0 && !c2p_lane_(0,i)) {
+          for (int n = 0; n < NHYDRO; ++n) {
+            prim(n,k,j,i) = prim_old(n,k,j,i);
           }
-          fixed = true;
+          success = false;
         }
 
         // Apply velocity ceiling
@@ -234,19 +277,11 @@ void EquationOfState::ConservedToPrimitive(
                     + g_(I13,i)*u3*bb1 + g_(I23,i)*u3*bb2 + g_(I33,i)*u3*bb3;
           pmag = 0.5 * (normal_bb_(0,i)/SQR(gamma) + SQR(b0/u0));
         }
-        density_floor_local = density_floor_;
-        if (rho_pow_ != 0.0) {
-          density_floor_local =
-              std::max(density_floor_local, rho_min_ * std::pow(pco->x1v(i), rho_pow_));
-        }
+        Real density_floor_local = c2p_scratch_(7,i);
         if (sigma_max_ > 0.0) {
           density_floor_local = std::max(density_floor_local, 2.0*pmag/sigma_max_);
         }
-        pressure_floor_local = pressure_floor_;
-        if (pgas_pow_ != 0.0) {
-          pressure_floor_local = std::max(pressure_floor_local,
-                                          pgas_min_ * std::pow(pco->x1v(i), pgas_pow_));
-        }
+        Real pressure_floor_local = c2p_scratch_(8,i);
         if (beta_min_ > 0.0) {
           pressure_floor_local = std::max(pressure_floor_local, beta_min_*pmag);
         }
@@ -339,6 +374,7 @@ void CalculateNormalConserved(
     AthenaArray<Real> &dd, AthenaArray<Real> &ee, AthenaArray<Real> &mm,
     AthenaArray<Real> &bbb, AthenaArray<Real> &tt) {
   // Go through row
+#pragma omp simd
   for (int i=il; i<=iu; ++i) {
     // Extract metric
     const Real &g_11 = g(I11,i), &g_12 = g(I12,i), &g_13 = g(I13,i),
@@ -421,12 +457,14 @@ void CalculateNormalConserved(
 //   tt_vals: array of M_i B^i values
 //   gamma_adi: ratio of specific heats
 //   pgas_old: previous value of p_{gas} used to initialize iteration
+//   max_iterations: maximum number of iterations
 //   k, j, i: indices of cell
 // Outputs:
 //   returned value: true for successful convergence, false otherwise
 //   prim: all values set in given cell
 //   p_gamma_lor: normal-frame Lorentz factor
 //   p_pmag: magnetic pressure
+//   p_iterations: number of iterations used
 // Notes:
 //   Generalizes Newman & Hamlin 2014, SIAM J. Sci. Comput. 36(4) B661 (NH).
 //     Like SR, but all 3-vector operations done with respect to g_{ij} rather than
@@ -447,15 +485,13 @@ void CalculateNormalConserved(
 bool ConservedToPrimitiveNormal(
     const AthenaArray<Real> &dd_vals, const AthenaArray<Real> &ee_vals,
     const AthenaArray<Real> &mm_vals, const AthenaArray<Real> &bb_vals,
-    const AthenaArray<Real> &tt_vals, Real gamma_adi, Real pgas_old, int k, int j, int i,
-    AthenaArray<Real> &prim, Real *p_gamma_lor, Real *p_pmag) {
+    const AthenaArray<Real> &tt_vals, Real gamma_adi, Real pgas_old, int max_iterations,
+    int k, int j, int i, AthenaArray<Real> &prim, Real *p_gamma_lor, Real *p_pmag,
+    int *p_iterations) {
   // Parameters
-  const int max_iterations = 15;
-  const Real tol = 1.0e-12;
   const Real pgas_uniform_min = 1.0e-12;
   const Real a_min = 1.0e-12;
   const Real v_sq_max = 1.0 - 1.0e-12;
-  const Real rr_max = 1.0 - 1.0e-12;
 
   // Extract conserved values
   const Real &dd = dd_vals(i);
@@ -479,8 +515,78 @@ bool ConservedToPrimitiveNormal(
   // Iterate until convergence
   Real pgas[3];
   pgas[0] = std::max(pgas_old, pgas_min);
+  int n = IteratePressure(dd, ee, mm_sq, bb_sq, tt, d, pgas_min, gamma_adi, 0,
+                          max_iterations, pgas);
+
+  // Step 5: Set primitives
+  *p_iterations = std::min(n + 1, max_iterations);
+  if (n == max_iterations) {
+    return false;
+  }
+  prim(IPR,k,j,i) = pgas[(n+1)%3];
+  if (!std::isfinite(prim(IPR,k,j,i))) {
+    return false;
+  }
+  Real a = ee + prim(IPR,k,j,i) + 0.5*bb_sq;                      // (NH 5.7)
+  a = std::max(a, a_min);
+  Real phi = std::acos(1.0/a * std::sqrt(27.0*d/(4.0*a)));        // (NH 5.10)
+  Real eee = a/3.0 - 2.0/3.0 * a * std::cos(2.0/3.0 * (phi+PI));  // (NH 5.11)
+  Real ll = eee - bb_sq;                                          // (NH 5.5)
+  Real v_sq = (mm_sq*SQR(ll) + SQR(tt)*(bb_sq+2.0*ll))
+              / SQR(ll * (bb_sq+ll));                             // (NH 5.2)
+  v_sq = std::min(std::max(v_sq, static_cast<Real>(0.0)), v_sq_max);
+  Real gamma_sq = 1.0/(1.0-v_sq);                                 // (NH 3.1)
+  Real gamma = std::sqrt(gamma_sq);                               // (NH 3.1)
+  prim(IDN,k,j,i) = dd/gamma;                                     // (NH 4.5)
+  if (!std::isfinite(prim(IDN,k,j,i))) {
+    return false;
+  }
+  Real ss = tt/ll;                          // (NH 4.8)
+  Real v1 = (mm1 + ss*bb1) / (ll + bb_sq);  // (NH 4.6)
+  Real v2 = (mm2 + ss*bb2) / (ll + bb_sq);  // (NH 4.6)
+  Real v3 = (mm3 + ss*bb3) / (ll + bb_sq);  // (NH 4.6)
+  prim(IVX,k,j,i) = gamma*v1;               // (NH 3.3)
+  prim(IVY,k,j,i) = gamma*v2;               // (NH 3.3)
+  prim(IVZ,k,j,i) = gamma*v3;               // (NH 3.3)
+  if (!std::isfinite(prim(IVX,k,j,i))
+      || !std::isfinite(prim(IVY,k,j,i))
+      || !std::isfinite(prim(IVZ,k,j,i))) {
+    return false;
+  }
+  *p_gamma_lor = gamma;
+  *p_pmag = 0.5 * (bb_sq/gamma_sq + SQR(ss));  // (NH 3.7, 3.11)
+  return true;
+}
+
+//----------------------------------------------------------------------------------------
+// Function for iterating on gas pressure in normal observer frame
+// Inputs:
+//   dd, ee, mm_sq, bb_sq, tt: conserved values, as in ConservedToPrimitiveNormal()
+//   d: function of conserved values (NH 5.7)
+//   pgas_min: minimum pressure
+//   gamma_adi: ratio of specific heats
+//   n_start: first step of iteration
+//   max_iterations: maximum number of iterations
+//   pgas: pressures of last three steps, pgas[n_start%3] set to current value
+// Outputs:
+//   returned value: step at which iteration converged, or max_iterations
+//   pgas: pressures updated, pgas[(n+1)%3] set to converged value for returned n
+// Notes:
+//   Iteration of ConservedToPrimitiveNormal(), which starts at n_start = 0;
+//       ConservedToPrimitiveNormalRow() continues it from later steps.
+
+int IteratePressure(Real dd, Real ee, Real mm_sq, Real bb_sq, Real tt, Real d,
+                    Real pgas_min, Real gamma_adi, int n_start, int max_iterations,
+                    Real pgas[3]) {
+  // Parameters
+  const Real tol = 1.0e-12;
+  const Real a_min = 1.0e-12;
+  const Real v_sq_max = 1.0 - 1.0e-12;
+  const Real rr_max = 1.0 - 1.0e-12;
+
+  // Iterate until convergence
   int n;
-  for (n = 0; n < max_iterations; ++n) {
+  for (n = n_start; n < max_iterations; ++n) {
     // Step 1: Calculate cubic coefficients
     Real a;
     if (n%3 != 2) {
@@ -524,44 +630,226 @@ bool ConservedToPrimitiveNormal(
       }
     }
   }
+  return n;
+}
 
-  // Step 5: Set primitives
-  if (n == max_iterations) {
-    return false;
+//----------------------------------------------------------------------------------------
+// Function for calculating primitives in normal observer frame in a row of cells
+// Inputs:
+//   dd_vals, ee_vals, mm_vals, bb_vals, tt_vals: as in ConservedToPrimitiveNormal()
+//   gamma_adi: ratio of specific heats
+//   prim_old: primitives from previous half timestep, used to initialize iteration
+//   k, j, il, iu: indices and index bounds of row
+//   lane: lane(0,i) set to 1 in cells to be inverted and 0 in cells to be skipped
+// Outputs:
+//   lane: lane(0,i) set to 1 for success, 0 otherwise; lane(1,i) set to number of
+//       iterations used, or -1 in skipped cells
+//   scratch: rows 0-4 overwritten; in successful cells, scratch(5,i) set to normal-frame
+//       Lorentz factor and scratch(6,i) to magnetic pressure
+//   prim: all values set in successful cells
+//   p_iterations, p_fallbacks, p_failures: incremented by totals over row
+// Notes:
+//   Performs the same operations in each cell as ConservedToPrimitiveNormal(), so
+//       converged cells are bitwise identical, but advances all cells of the row through
+//       the iteration together so that the loops over cells vectorize. The step n, and
+//       with it the choice between a cubic solve and an Aitken update, is the same in all
+//       cells, and cells that have converged are masked out. Most cells converge in one
+//       or two steps, so once fewer than a quarter remain they finish the iteration one
+//       at a time with IteratePressure() instead of holding up the whole row.
+//   Cells that do not converge are retried one at a time with
+//       ConservedToPrimitiveNormal(), starting from the pressure floor and allowing more
+//       iterations.
+
+void ConservedToPrimitiveNormalRow(
+    const AthenaArray<Real> &dd_vals, const AthenaArray<Real> &ee_vals,
+    const AthenaArray<Real> &mm_vals, const AthenaArray<Real> &bb_vals,
+    const AthenaArray<Real> &tt_vals, Real gamma_adi, const AthenaArray<Real> &prim_old,
+    int k, int j, int il, int iu, AthenaArray<int> &lane, AthenaArray<Real> &scratch,
+    AthenaArray<Real> &prim, std::int64_t *p_iterations, std::int64_t *p_fallbacks,
+    std::int64_t *p_failures) {
+  // Parameters, as in ConservedToPrimitiveNormal()
+  const int max_iterations = 15;
+  const int max_iterations_fallback = 60;
+  const Real tol = 1.0e-12;
+  const Real pgas_uniform_min = 1.0e-12;
+  const Real a_min = 1.0e-12;
+  const Real v_sq_max = 1.0 - 1.0e-12;
+  const Real rr_max = 1.0 - 1.0e-12;
+
+  // Calculate functions of conserved quantities and initialize iteration
+  int num_active = 0;
+#pragma omp simd reduction(+:num_active)
+  for (int i=il; i<=iu; ++i) {
+    const Real &ee = ee_vals(i);
+    const Real &mm_sq = mm_vals(0,i);
+    const Real &bb_sq = bb_vals(0,i);
+    const Real &tt = tt_vals(i);
+    Real d = 0.5 * (mm_sq * bb_sq - SQR(tt));                  // (NH 5.7)
+    d = std::max(d, static_cast<Real>(0.0));
+    Real pgas_min = std::cbrt(27.0/4.0 * d) - ee - 0.5*bb_sq;
+    pgas_min = std::max(pgas_min, pgas_uniform_min);
+    scratch(0,i) = std::max(prim_old(IPR,k,j,i), pgas_min);
+    scratch(3,i) = d;
+    scratch(4,i) = pgas_min;
+    lane(1,i) = lane(0,i) ? max_iterations : -1;
+    num_active += lane(0,i);
   }
-  prim(IPR,k,j,i) = pgas[(n+1)%3];
-  if (!std::isfinite(prim(IPR,k,j,i))) {
-    return false;
+  if (num_active == 0) {
+    return;
   }
-  Real a = ee + prim(IPR,k,j,i) + 0.5*bb_sq;                      // (NH 5.7)
-  a = std::max(a, a_min);
-  Real phi = std::acos(1.0/a * std::sqrt(27.0*d/(4.0*a)));        // (NH 5.10)
-  Real eee = a/3.0 - 2.0/3.0 * a * std::cos(2.0/3.0 * (phi+PI));  // (NH 5.11)
-  Real ll = eee - bb_sq;                                          // (NH 5.5)
-  Real v_sq = (mm_sq*SQR(ll) + SQR(tt)*(bb_sq+2.0*ll))
-              / SQR(ll * (bb_sq+ll));                             // (NH 5.2)
-  v_sq = std::min(std::max(v_sq, static_cast<Real>(0.0)), v_sq_max);
-  Real gamma_sq = 1.0/(1.0-v_sq);                                 // (NH 3.1)
-  Real gamma = std::sqrt(gamma_sq);                               // (NH 3.1)
-  prim(IDN,k,j,i) = dd/gamma;                                     // (NH 4.5)
-  if (!std::isfinite(prim(IDN,k,j,i))) {
-    return false;
+
+  // Iterate in all cells together while at least a quarter of them are unconverged
+  const int num_masked_min = (num_active + 3)/4;
+  int n;
+  for (n = 0; n < max_iterations && num_active >= num_masked_min; ++n) {
+    const int m0 = n%3, m1 = (n+1)%3;
+    num_active = 0;
+    if (n%3 != 2) {
+      // Steps 1-3: calculate cubic coefficients, root, and new pressure; check for
+      // convergence
+#pragma omp simd reduction(+:num_active)
+      for (int i=il; i<=iu; ++i) {
+        const Real &dd = dd_vals(i);
+        const Real &ee = ee_vals(i);
+        const Real &mm_sq = mm_vals(0,i);
+        const Real &bb_sq = bb_vals(0,i);
+        const Real &tt = tt_vals(i);
+        const Real &d = scratch(3,i);
+        const Real &pgas_min = scratch(4,i);
+        Real a = ee + scratch(m0,i) + 0.5*bb_sq;                        // (NH 5.7)
+        a = std::max(a, a_min);
+        Real phi = std::acos(1.0/a * std::sqrt(27.0*d/(4.0*a)));        // (NH 5.10)
+        Real eee = a/3.0 - 2.0/3.0 * a * std::cos(2.0/3.0 * (phi+PI));  // (NH 5.11)
+        Real ll = eee - bb_sq;                                          // (NH 5.5)
+        Real v_sq = (mm_sq*SQR(ll) + SQR(tt)*(bb_sq+2.0*ll))
+                    / SQR(ll * (bb_sq+ll));                             // (NH 5.2)
+        v_sq = std::min(std::max(v_sq, static_cast<Real>(0.0)), v_sq_max);
+        Real gamma_sq = 1.0/(1.0-v_sq);                                 // (NH 3.1)
+        Real gamma = std::sqrt(gamma_sq);                               // (NH 3.1)
+        Real wgas = ll/gamma_sq;                                        // (NH 5.1)
+        Real rho = dd/gamma;                                            // (NH 4.5)
+        Real pgas_new = (gamma_adi-1.0)/gamma_adi * (wgas - rho);       // (NH 4.1)
+        pgas_new = std::max(pgas_new, pgas_min);
+        bool active = lane(0,i);
+        bool converged = active && pgas_new > pgas_min
+                         && std::abs(pgas_new-scratch(m0,i)) < tol;
+        scratch(m1,i) = active ? pgas_new : scratch(m1,i);
+        lane(1,i) = converged ? n : lane(1,i);
+        lane(0,i) = active && !converged;
+        num_active += lane(0,i);
+      }
+    } else {
+      // Step 4: calculate Aitken accelerant and check for convergence
+#pragma omp simd reduction(+:num_active)
+      for (int i=il; i<=iu; ++i) {
+        const Real &pgas_min = scratch(4,i);
+        const Real &pgas0 = scratch(0,i), &pgas1 = scratch(1,i), &pgas2 = scratch(2,i);
+        Real rr = (pgas2 - pgas1) / (pgas1 - pgas0);                    // (NH 7.1)
+        Real pgas_new = pgas1 + (pgas2 - pgas1) / (1.0 - rr);           // (NH 7.2)
+        pgas_new = std::max(pgas_new, pgas_min);
+        bool active = lane(0,i);
+        bool accelerate = active && std::isfinite(rr) && std::abs(rr) <= rr_max;
+        bool converged = accelerate && pgas_new > pgas_min
+                         && std::abs(pgas_new-pgas2) < tol;
+        scratch(0,i) = accelerate ? pgas_new : pgas0;
+        lane(1,i) = converged ? n : lane(1,i);
+        lane(0,i) = active && !converged;
+        num_active += lane(0,i);
+      }
+    }
   }
-  Real ss = tt/ll;                          // (NH 4.8)
-  Real v1 = (mm1 + ss*bb1) / (ll + bb_sq);  // (NH 4.6)
-  Real v2 = (mm2 + ss*bb2) / (ll + bb_sq);  // (NH 4.6)
-  Real v3 = (mm3 + ss*bb3) / (ll + bb_sq);  // (NH 4.6)
-  prim(IVX,k,j,i) = gamma*v1;               // (NH 3.3)
-  prim(IVY,k,j,i) = gamma*v2;               // (NH 3.3)
-  prim(IVZ,k,j,i) = gamma*v3;               // (NH 3.3)
-  if (!std::isfinite(prim(IVX,k,j,i))
-      || !std::isfinite(prim(IVY,k,j,i))
-      || !std::isfinite(prim(IVZ,k,j,i))) {
-    return false;
+
+  // Continue iteration in remaining cells one at a time
+  if (num_active > 0 && n < max_iterations) {
+    for (int i=il; i<=iu; ++i) {
+      if (!lane(0,i)) {
+        continue;
+      }
+      Real pgas[3] = {scratch(0,i), scratch(1,i), scratch(2,i)};
+      lane(1,i) = IteratePressure(dd_vals(i), ee_vals(i), mm_vals(0,i), bb_vals(0,i),
+                                  tt_vals(i), scratch(3,i), scratch(4,i), gamma_adi, n,
+                                  max_iterations, pgas);
+      scratch(0,i) = pgas[0];
+      scratch(1,i) = pgas[1];
+      scratch(2,i) = pgas[2];
+      lane(0,i) = 0;
+    }
   }
-  *p_gamma_lor = gamma;
-  *p_pmag = 0.5 * (bb_sq/gamma_sq + SQR(ss));  // (NH 3.7, 3.11)
-  return true;
+
+  // Step 5: set primitives
+  std::int64_t num_iterations = 0;
+  int num_failed = 0;
+#pragma omp simd reduction(+:num_iterations,num_failed)
+  for (int i=il; i<=iu; ++i) {
+    const Real &dd = dd_vals(i);
+    const Real &ee = ee_vals(i);
+    const Real &mm_sq = mm_vals(0,i);
+    const Real &mm1 = mm_vals(1,i);
+    const Real &mm2 = mm_vals(2,i);
+    const Real &mm3 = mm_vals(3,i);
+    const Real &bb_sq = bb_vals(0,i);
+    const Real &bb1 = bb_vals(1,i);
+    const Real &bb2 = bb_vals(2,i);
+    const Real &bb3 = bb_vals(3,i);
+    const Real &tt = tt_vals(i);
+    const Real &d = scratch(3,i);
+    const int n = lane(1,i);
+    Real pgas = scratch((n+1)%3,i);
+    Real a = ee + pgas + 0.5*bb_sq;                                 // (NH 5.7)
+    a = std::max(a, a_min);
+    Real phi = std::acos(1.0/a * std::sqrt(27.0*d/(4.0*a)));        // (NH 5.10)
+    Real eee = a/3.0 - 2.0/3.0 * a * std::cos(2.0/3.0 * (phi+PI));  // (NH 5.11)
+    Real ll = eee - bb_sq;                                          // (NH 5.5)
+    Real v_sq = (mm_sq*SQR(ll) + SQR(tt)*(bb_sq+2.0*ll))
+                / SQR(ll * (bb_sq+ll));                             // (NH 5.2)
+    v_sq = std::min(std::max(v_sq, static_cast<Real>(0.0)), v_sq_max);
+    Real gamma_sq = 1.0/(1.0-v_sq);                                 // (NH 3.1)
+    Real gamma = std::sqrt(gamma_sq);                               // (NH 3.1)
+    Real rho = dd/gamma;                                            // (NH 4.5)
+    Real ss = tt/ll;                          // (NH 4.8)
+    Real v1 = (mm1 + ss*bb1) / (ll + bb_sq);  // (NH 4.6)
+    Real v2 = (mm2 + ss*bb2) / (ll + bb_sq);  // (NH 4.6)
+    Real v3 = (mm3 + ss*bb3) / (ll + bb_sq);  // (NH 4.6)
+    Real uu1 = gamma*v1;                      // (NH 3.3)
+    Real uu2 = gamma*v2;                      // (NH 3.3)
+    Real uu3 = gamma*v3;                      // (NH 3.3)
+    bool success = n >= 0 && n < max_iterations && std::isfinite(pgas)
+                   && std::isfinite(rho) && std::isfinite(uu1) && std::isfinite(uu2)
+                   && std::isfinite(uu3);
+    if (success) {
+      prim(IDN,k,j,i) = rho;
+      prim(IPR,k,j,i) = pgas;
+      prim(IVX,k,j,i) = uu1;
+      prim(IVY,k,j,i) = uu2;
+      prim(IVZ,k,j,i) = uu3;
+      scratch(5,i) = gamma;
+      scratch(6,i) = 0.5 * (bb_sq/gamma_sq + SQR(ss));  // (NH 3.7, 3.11)
+    }
+    num_iterations += (n < 0) ? 0 : std::min(n + 1, max_iterations);
+    num_failed += (n >= 0 && !success);
+    lane(0,i) = success;
+  }
+  *p_iterations += num_iterations;
+
+  // Retry failed cells
+  if (num_failed > 0) {
+    for (int i=il; i<=iu; ++i) {
+      if (lane(1,i) < 0 || lane(0,i)) {
+        continue;
+      }
+      int iterations;
+      bool success = ConservedToPrimitiveNormal(dd_vals, ee_vals, mm_vals, bb_vals,
+                                                tt_vals, gamma_adi, 0.0,
+                                                max_iterations_fallback, k, j, i, prim,
+                                                &scratch(5,i), &scratch(6,i),
+                                                &iterations);
+      lane(0,i) = success;
+      *p_iterations += iterations;
+      *p_fallbacks += 1;
+      *p_failures += !success;
+    }
+  }
+  return;
 }
 
 //----------------------------------------------------------------------------------------
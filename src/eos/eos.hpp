@@ -13,6 +13,7 @@
 // C headers
 
 // C++ headers
+#include <cstdint>    // std::int64_t
 #include <limits>     // std::numeric_limits<float>
 
 // Athena++ headers
@@ -145,10 +146,17 @@ class EquationOfState {
   Real PresFromRhoEg(Real rho, Real egas);
   Real EgasFromRhoP(Real rho, Real pres);
   Real AsqFromRhoP(Real rho, Real pres);
+  // batched versions for n consecutive values (general EOS); output may alias an input
+  void PresFromRhoEg(const int n, const Real *rho, const Real *egas, Real *pres);
+  void EgasFromRhoP(const int n, const Real *rho, const Real *pres, Real *egas);
+  void AsqFromRhoP(const int n, const Real *rho, const Real *pres, Real *asq);
   Real GetIsoSoundSpeed() const {return iso_sound_speed_;}
   Real GetDensityFloor() const {return density_floor_;}
   Real GetPressureFloor() const {return pressure_floor_;}
   EosTable* ptable; // pointer to EOS table data
+  // cumulative statistics of the conserved-to-primitive inversion in GR MHD: iterations,
+  // cells retried with the fallback solver, and cells in which the fallback failed too
+  std::int64_t c2p_iterations{0}, c2p_fallbacks{0}, c2p_failures{0};
 #if GENERAL_EOS
   Real GetGamma();
 #else // not GENERAL_EOS
@@ -176,6 +184,8 @@ class EquationOfState {
   AthenaArray<Real> normal_mm_;          // normal-frame momenta, used in relativity
   AthenaArray<Real> normal_bb_;          // normal-frame fields, used in relativistic MHD
   AthenaArray<Real> normal_tt_;          // normal-frame M.B, used in relativistic MHD
+  AthenaArray<Real> c2p_scratch_;        // per-cell iteration state, used in GR MHD
+  AthenaArray<int> c2p_lane_;            // per-cell flags and iterations, used in GR MHD
   void InitEosConstants(ParameterInput *pin);
 };
 
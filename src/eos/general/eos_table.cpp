@@ -10,7 +10,10 @@
 // C headers
 
 // C++ headers
+#include <algorithm> // min()
 #include <cmath>   // sqrt()
+#include <cstdint> // uint64_t
+#include <cstring> // memcpy()
 #include <fstream>
 #include <iostream> // ifstream
 #include <sstream>
@@ -28,6 +31,76 @@
 
 namespace {
 Real dens_pow = -1.0;
+const int kBatch = 64;  // values per chunk of the batched table lookups
+
+double AsDouble(std::uint64_t u) {
+  double d;
+  std::memcpy(&d, &u, sizeof(d));
+  return d;
+}
+
+std::uint64_t AsBits(double d) {
+  std::uint64_t u;
+  std::memcpy(&u, &d, sizeof(u));
+  return u;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn double FastLog10(double x)
+//! \brief branch-free log10 of a positive, normal x for the batched lookups.
+//!
+//! x = m*2^e with m in [sqrt(1/2),sqrt(2)), and ln(m) = 2*atanh(s), s = (m-1)/(m+1), is
+//! summed through s^15. The truncation error is below 1e-14, so the absolute error is
+//! below 1e-15 + 2e-16*|log10(x)| (5.7e-14 at |log10(x)| = 300).
+double FastLog10(double x) {
+  const double ln2 = 0.693147180559945309417232121458;
+  const double log10e = 0.434294481903251827651128918917;
+  const std::uint64_t sqrt_half = 0x3fe6a09e667f3bcdULL;
+  std::uint64_t ix = AsBits(x) + (0x3ff0000000000000ULL - sqrt_half);
+  // exponent e as a double: bias the 11-bit field into the mantissa of 2^52
+  double e = AsDouble((ix >> 52) | 0x4330000000000000ULL) - (4503599627370496.0 + 1023.0);
+  double m = AsDouble((ix & 0x000fffffffffffffULL) + sqrt_half);
+  double s = (m - 1.0)/(m + 1.0), s2 = s*s;
+  double p = 1.0/15.0;
+  p = p*s2 + 1.0/13.0;
+  p = p*s2 + 1.0/11.0;
+  p = p*s2 + 1.0/9.0;
+  p = p*s2 + 1.0/7.0;
+  p = p*s2 + 1.0/5.0;
+  p = p*s2 + 1.0/3.0;
+  p = p*s2 + 1.0;
+  return (e*ln2 + 2.0*s*p)*log10e;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn double FastExp10(double y)
+//! \brief branch-free 10^y for |y| <= 307 for the batched lookups.
+//!
+//! 10^y = 2^n*exp(z*ln2), with n = round(y*log2(10)) and |z| <= 1/2; the exponential is
+//! summed through z^13. The relative error is below 1.2e-15 for |y| <= 4 and grows with
+//! the rounding error of y*log2(10) to 7.4e-14 at |y| = 300.
+double FastExp10(double y) {
+  const double log2_10 = 3.32192809488736234787031942949;
+  const double ln2 = 0.693147180559945309417232121458;
+  double t = y*log2_10;
+  int ni = static_cast<int>(t + 1023.5);  // round(t) + exponent bias; t > -1023.5
+  double z = (t - static_cast<double>(ni - 1023))*ln2;
+  double p = 1.0/6227020800.0;
+  p = p*z + 1.0/479001600.0;
+  p = p*z + 1.0/39916800.0;
+  p = p*z + 1.0/3628800.0;
+  p = p*z + 1.0/362880.0;
+  p = p*z + 1.0/40320.0;
+  p = p*z + 1.0/5040.0;
+  p = p*z + 1.0/720.0;
+  p = p*z + 1.0/120.0;
+  p = p*z + 1.0/24.0;
+  p = p*z + 1.0/6.0;
+  p = p*z + 0.5;
+  p = p*z + 1.0;
+  p = p*z + 1.0;
+  return p*AsDouble(static_cast<std::uint64_t>(ni) << 52);
+}
 
 //----------------------------------------------------------------------------------------
 //! \fn Real GetEosData(EosTable *ptable, int kOut, Real var, Real rho)
@@ -38,6 +111,35 @@ inline Real GetEosData(EosTable *ptable, int kOut, Real var, Real rho) {
   Real x2 = std::log10(var * ptable->EosRatios(kOut) * ptable->eUnit) + dens_pow * x1;
   return std::pow((Real)10, ptable->table.interpolate(kOut, x2, x1));
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void GetEosData(EosTable *ptable, int kOut, int n, const Real *var,
+//!                     const Real *rho, Real *out)
+//! \brief GetEosData() for n <= kBatch values, out[m] = GetEosData(..., var[m], rho[m]),
+//!        with FastLog10()/FastExp10() in place of std::log10()/std::pow(). The result
+//!        differs from the scalar version by less than 1e-14 (relative) for table
+//!        values within [-4,4] (dex); this is far below the error of the bilinear
+//!        interpolation itself.
+void GetEosData(EosTable *ptable, int kOut, int n, const Real *var, const Real *rho,
+                Real *out) {
+  Real x1[kBatch], x2[kBatch];
+  const Real var_unit = ptable->EosRatios(kOut) * ptable->eUnit;
+  const Real rho_unit = ptable->rhoUnit;
+#pragma omp simd
+  for (int m=0; m<n; ++m) {
+    x1[m] = FastLog10(rho[m] * rho_unit);
+    x2[m] = FastLog10(var[m] * var_unit) + dens_pow * x1[m];
+  }
+  ptable->table.interpolate(kOut, n, x2, x1, out);
+  // keep the argument of FastExp10 within its domain
+  for (int m=0; m<n; ++m) {
+    out[m] = (out[m] < -307.0) ? -307.0 : out[m];
+    out[m] = (out[m] > 307.0) ? 307.0 : out[m];
+  }
+#pragma omp simd
+  for (int m=0; m<n; ++m)
+    out[m] = FastExp10(out[m]);
+}
 } // namespace
 
 //----------------------------------------------------------------------------------------
@@ -61,6 +163,55 @@ Real EquationOfState::AsqFromRhoP(Real rho, Real pres) {
   return GetEosData(ptable, 2, pres, rho) * pres / rho;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void EquationOfState::PresFromRhoEg(const int n, const Real *rho,
+//!                                         const Real *egas, Real *pres)
+//! \brief Return interpolated gas pressure of n values; pres may alias egas
+void EquationOfState::PresFromRhoEg(const int n, const Real *rho, const Real *egas,
+                                    Real *pres) {
+  Real data[kBatch];
+  for (int m0=0; m0<n; m0+=kBatch) {
+    int nb = std::min(kBatch, n - m0);
+    GetEosData(ptable, 0, nb, egas + m0, rho + m0, data);
+#pragma omp simd
+    for (int m=0; m<nb; ++m)
+      pres[m0+m] = data[m] * egas[m0+m];
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void EquationOfState::EgasFromRhoP(const int n, const Real *rho,
+//!                                        const Real *pres, Real *egas)
+//! \brief Return interpolated internal energy density of n values; egas may alias pres
+void EquationOfState::EgasFromRhoP(const int n, const Real *rho, const Real *pres,
+                                   Real *egas) {
+  Real data[kBatch];
+  for (int m0=0; m0<n; m0+=kBatch) {
+    int nb = std::min(kBatch, n - m0);
+    GetEosData(ptable, 1, nb, pres + m0, rho + m0, data);
+#pragma omp simd
+    for (int m=0; m<nb; ++m)
+      egas[m0+m] = data[m] * pres[m0+m];
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void EquationOfState::AsqFromRhoP(const int n, const Real *rho,
+//!                                       const Real *pres, Real *asq)
+//! \brief Return interpolated adiabatic sound speed squared of n values; asq may alias
+//!        rho or pres
+void EquationOfState::AsqFromRhoP(const int n, const Real *rho, const Real *pres,
+                                  Real *asq) {
+  Real data[kBatch];
+  for (int m0=0; m0<n; m0+=kBatch) {
+    int nb = std::min(kBatch, n - m0);
+    GetEosData(ptable, 2, nb, pres + m0, rho + m0, data);
+#pragma omp simd
+    for (int m=0; m<nb; ++m)
+      asq[m0+m] = data[m] * pres[m0+m] / rho[m0+m];
+  }
+}
+
 //----------------------------------------------------------------------------------------
 //! void EquationOfState::InitEosConstants(ParameterInput* pin)
 //! \brief Initialize constants for EOS
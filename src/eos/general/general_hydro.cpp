@@ -13,6 +13,9 @@
 //! Real EquationOfState::EgasFromRhoP(Real rho, Real pres)
 //! Real EquationOfState::AsqFromRhoP(Real rho, Real pres)
 //! void EquationOfState::InitEosConstants(ParameterInput *pin) // can be empty
+//!
+//! The batched (pencil-wide) versions of the first three are implemented here by calling
+//! the scalar ones, except for the EOS table, which provides its own.
 
 
 // C headers
@@ -106,8 +109,9 @@ void EquationOfState::ConservedToPrimitive(
         u_e = (u_e - ke > energy_floor_) ?  u_e : energy_floor_ + ke;
         // MSBC: if ke >> energy_floor_ then u_e - ke may still be zero at this point due
         //       to floating point errors/catastrophic cancellation
-        w_p = PresFromRhoEg(u_d, u_e - ke);
+        w_p = u_e - ke;  // internal energy, converted to pressure below
       }
+      PresFromRhoEg(iu-il+1, &cons(IDN,k,j,il), &prim(IPR,k,j,il), &prim(IPR,k,j,il));
     }
   }
 
@@ -125,12 +129,9 @@ void EquationOfState::PrimitiveToConserved(
     const AthenaArray<Real> &prim, const AthenaArray<Real> &bc,
     AthenaArray<Real> &cons, Coordinates *pco,
     int il, int iu, int jl, int ju, int kl, int ku) {
-  // Force outer-loop vectorization
-#pragma omp simd
   for (int k=kl; k<=ku; ++k) {
     for (int j=jl; j<=ju; ++j) {
-      //#pragma omp simd
-#pragma novector
+#pragma omp simd
       for (int i=il; i<=iu; ++i) {
         Real& u_d  = cons(IDN,k,j,i);
         Real& u_m1 = cons(IM1,k,j,i);
@@ -148,8 +149,17 @@ void EquationOfState::PrimitiveToConserved(
         u_m1 = w_vx*w_d;
         u_m2 = w_vy*w_d;
         u_m3 = w_vz*w_d;
-        // cellwise conversion
-        u_e = EgasFromRhoP(u_d, w_p) + 0.5*w_d*(SQR(w_vx) + SQR(w_vy) + SQR(w_vz));
+        u_e = w_p;  // converted to internal energy below
+      }
+      EgasFromRhoP(iu-il+1, &cons(IDN,k,j,il), &cons(IEN,k,j,il), &cons(IEN,k,j,il));
+#pragma omp simd
+      for (int i=il; i<=iu; ++i) {
+        Real& u_e  = cons(IEN,k,j,i);
+        const Real& w_d  = prim(IDN,k,j,i);
+        const Real& w_vx = prim(IVX,k,j,i);
+        const Real& w_vy = prim(IVY,k,j,i);
+        const Real& w_vz = prim(IVZ,k,j,i);
+        u_e += 0.5*w_d*(SQR(w_vx) + SQR(w_vy) + SQR(w_vz));
       }
     }
   }
@@ -157,6 +167,44 @@ void EquationOfState::PrimitiveToConserved(
   return;
 }
 
+#if !EOS_TABLE_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn void EquationOfState::PresFromRhoEg(const int n, const Real *rho,
+//!                                         const Real *egas, Real *pres)
+//! \brief gas pressure of n values; pres may alias egas
+
+void EquationOfState::PresFromRhoEg(const int n, const Real *rho, const Real *egas,
+                                    Real *pres) {
+  for (int m=0; m<n; ++m)
+    pres[m] = PresFromRhoEg(rho[m], egas[m]);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void EquationOfState::EgasFromRhoP(const int n, const Real *rho,
+//!                                        const Real *pres, Real *egas)
+//! \brief internal energy density of n values; egas may alias pres
+
+void EquationOfState::EgasFromRhoP(const int n, const Real *rho, const Real *pres,
+                                   Real *egas) {
+  for (int m=0; m<n; ++m)
+    egas[m] = EgasFromRhoP(rho[m], pres[m]);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void EquationOfState::AsqFromRhoP(const int n, const Real *rho,
+//!                                       const Real *pres, Real *asq)
+//! \brief adiabatic sound speed squared of n values; asq may alias rho or pres
+
+void EquationOfState::AsqFromRhoP(const int n, const Real *rho, const Real *pres,
+                                  Real *asq) {
+  for (int m=0; m<n; ++m)
+    asq[m] = AsqFromRhoP(rho[m], pres[m]);
+  return;
+}
+#endif  // !EOS_TABLE_ENABLED
+
 //----------------------------------------------------------------------------------------
 //! \fn Real EquationOfState::SoundSpeed(Real prim[NHYDRO])
 //! \brief returns adiabatic sound speed given vector of primitive variables
@@ -40,6 +40,14 @@ FFTDriver::FFTDriver(Mesh *pm, ParameterInput *pin) : nranks_(Globals::nranks),
     ATHENA_ERROR(msg);
     return;
   }
+  if (pm->lb_hilbert_ || pm->lb_surface_) {
+    std::stringstream msg;
+    msg << "### FATAL ERROR in FFTDriver::FFTDriver" << std::endl
+        << "<loadbalancing>/sfc = hilbert and partitioner = surface are not supported; "
+        << "every rank must own a cuboid of MeshBlocks." << std::endl;
+    ATHENA_ERROR(msg);
+    return;
+  }
 
   // Setting up the MPI information
   // *** this part should be modified when dedicate processes are allocated ***
@@ -29,87 +29,205 @@
 //! \brief Constrained Transport implementation of dB/dt = -Curl(E), where E=-(v X B)
 
 void Field::CT(const Real wght, FaceField &b_out) {
+  MeshBlock *pmb=pmy_block;
+  int js = pmb->js; int ks = pmb->ks;
+  int je = pmb->je; int ke = pmb->ke;
+  int jl, ju;
+  PolarFaceLimits(jl, ju);
+
+  //---- update B1
+  for (int k=ks; k<=ke; ++k) {
+    for (int j=js; j<=je; ++j) {
+      CTPencil1(wght, k, j, b_out);
+    }
+  }
+
+  //---- update B2 (curl terms in 1D and 3D problems)
+  for (int k=ks; k<=ke; ++k) {
+    for (int j=jl; j<=ju; ++j) {
+      CTPencil2(wght, k, j, b_out);
+    }
+  }
+
+  //---- update B3 (curl terms in 1D and 2D problems)
+  for (int k=ks; k<=ke+1; ++k) {
+    for (int j=js; j<=je; ++j) {
+      CTPencil3(wght, k, j, b_out);
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Field::WeightedAveCT(const Real wght_b1[5], const Real wght_b[5],
+//!                                 const Real wght)
+//! \brief Does the register averages and the CT update of a time integrator stage in
+//! one pass over each face component:
+//!   b1 = WeightedAve(b1, b, b2, b0, ct_update; wght_b1)
+//!   b  = WeightedAve(b, b1, b2, b0, ct_update; wght_b)
+//!   b -= wght*curl(E)
+//!
+//! Pencil by pencil, with the same operations per face as the separate sweeps, so the
+//! result is bitwise identical (see Hydro::WeightedAveFluxDivergence()).
+
+void Field::WeightedAveCT(const Real wght_b1[5], const Real wght_b[5], const Real wght) {
   MeshBlock *pmb=pmy_block;
   int is = pmb->is; int js = pmb->js; int ks = pmb->ks;
   int ie = pmb->ie; int je = pmb->je; int ke = pmb->ke;
+  int jl, ju;
+  PolarFaceLimits(jl, ju);
+  const bool swap = (wght_b[0] == 0.0 && wght_b[1] == 1.0 && wght_b[2] == 0.0);
+  FaceField &b_out = swap ? b1 : b;
 
-  AthenaArray<Real> &e1 = e.x1e, &e2 = e.x2e, &e3 = e.x3e;
-  AthenaArray<Real> &area = face_area_, &len = edge_length_, &len_p1 = edge_length_p1_;
+  //---- B1
+  for (int k=ks; k<=ke; ++k) {
+    for (int j=js; j<=je; ++j) {
+      pmb->WeightedAve(b1.x1f, b.x1f, b2.x1f, b0.x1f, ct_update.x1f, wght_b1,
+                       k, k, j, j, is, ie+1);
+      if (!swap)
+        pmb->WeightedAve(b.x1f, b1.x1f, b2.x1f, b0.x1f, ct_update.x1f, wght_b,
+                         k, k, j, j, is, ie+1);
+      CTPencil1(wght, k, j, b_out);
+    }
+  }
 
-  //---- update B1
+  //---- B2
   for (int k=ks; k<=ke; ++k) {
+    for (int j=jl; j<=ju; ++j) {
+      pmb->WeightedAve(b1.x2f, b.x2f, b2.x2f, b0.x2f, ct_update.x2f, wght_b1,
+                       k, k, j, j, is, ie);
+      if (!swap)
+        pmb->WeightedAve(b.x2f, b1.x2f, b2.x2f, b0.x2f, ct_update.x2f, wght_b,
+                         k, k, j, j, is, ie);
+      CTPencil2(wght, k, j, b_out);
+    }
+  }
+
+  //---- B3
+  for (int k=ks; k<=ke+1; ++k) {
     for (int j=js; j<=je; ++j) {
-      // add curl(E) in 2D and 3D problem
-      if (pmb->block_size.nx2 > 1) {
-        pmb->pcoord->Face1Area(k,j,is,ie+1,area);
-        pmb->pcoord->Edge3Length(k,j  ,is,ie+1,len);
-        pmb->pcoord->Edge3Length(k,j+1,is,ie+1,len_p1);
+      pmb->WeightedAve(b1.x3f, b.x3f, b2.x3f, b0.x3f, ct_update.x3f, wght_b1,
+                       k, k, j, j, is, ie);
+      if (!swap)
+        pmb->WeightedAve(b.x3f, b1.x3f, b2.x3f, b0.x3f, ct_update.x3f, wght_b,
+                         k, k, j, j, is, ie);
+      CTPencil3(wght, k, j, b_out);
+    }
+  }
+
+  if (swap) {
+    b.x1f.SwapAthenaArray(b1.x1f);
+    b.x2f.SwapAthenaArray(b1.x2f);
+    b.x3f.SwapAthenaArray(b1.x3f);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Field::PolarFaceLimits(int &jl, int &ju)
+//! \brief j-range of the x2-faces that are updated, which excludes the faces on a polar
+//! boundary
+
+void Field::PolarFaceLimits(int &jl, int &ju) {
+  MeshBlock *pmb=pmy_block;
+  jl = pmb->js; ju = pmb->je+1;
+  if (pmb->pbval->block_bcs[BoundaryFace::inner_x2] == BoundaryFlag::polar
+      || pmb->pbval->block_bcs[BoundaryFace::inner_x2] == BoundaryFlag::polar_wedge)
+    jl = pmb->js+1;
+  if (pmb->pbval->block_bcs[BoundaryFace::outer_x2] == BoundaryFlag::polar
+      || pmb->pbval->block_bcs[BoundaryFace::outer_x2] == BoundaryFlag::polar_wedge)
+    ju = pmb->je;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Field::CTPencil1(const Real wght, const int k, const int j,
+//!                             FaceField &b_out)
+//! \brief CT update of the x1-faces of the pencil (k,j)
+
+void Field::CTPencil1(const Real wght, const int k, const int j, FaceField &b_out) {
+  MeshBlock *pmb=pmy_block;
+  int is = pmb->is; int ie = pmb->ie;
+  AthenaArray<Real> &e2 = e.x2e, &e3 = e.x3e;
+  AthenaArray<Real> &area = face_area_, &len = edge_length_, &len_p1 = edge_length_p1_;
+
+  // add curl(E) in 2D and 3D problem
+  if (pmb->block_size.nx2 > 1) {
+    pmb->pcoord->Face1Area(k,j,is,ie+1,area);
+    pmb->pcoord->Edge3Length(k,j  ,is,ie+1,len);
+    pmb->pcoord->Edge3Length(k,j+1,is,ie+1,len_p1);
 #pragma omp simd
-        for (int i=is; i<=ie+1; ++i) {
-          b_out.x1f(k,j,i) -=
-              (wght/area(i))*(len_p1(i)*e3(k,j+1,i) - len(i)*e3(k,j,i));
-        }
+    for (int i=is; i<=ie+1; ++i) {
+      b_out.x1f(k,j,i) -=
+          (wght/area(i))*(len_p1(i)*e3(k,j+1,i) - len(i)*e3(k,j,i));
+    }
 
-        if (pmb->block_size.nx3 > 1) {
-          pmb->pcoord->Edge2Length(k  ,j,is,ie+1,len);
-          pmb->pcoord->Edge2Length(k+1,j,is,ie+1,len_p1);
+    if (pmb->block_size.nx3 > 1) {
+      pmb->pcoord->Edge2Length(k  ,j,is,ie+1,len);
+      pmb->pcoord->Edge2Length(k+1,j,is,ie+1,len_p1);
 #pragma omp simd
-          for (int i=is; i<=ie+1; ++i) {
-            b_out.x1f(k,j,i) +=
-                (wght/area(i))*(len_p1(i)*e2(k+1,j,i) - len(i)*e2(k,j,i));
-          }
-        }
+      for (int i=is; i<=ie+1; ++i) {
+        b_out.x1f(k,j,i) +=
+            (wght/area(i))*(len_p1(i)*e2(k+1,j,i) - len(i)*e2(k,j,i));
       }
     }
   }
+  return;
+}
 
-  //---- update B2 (curl terms in 1D and 3D problems)
-  for (int k=ks; k<=ke; ++k) {
-    // reset loop limits for polar boundary
-    int jl=js; int ju=je+1;
-    if (pmb->pbval->block_bcs[BoundaryFace::inner_x2] == BoundaryFlag::polar
-        || pmb->pbval->block_bcs[BoundaryFace::inner_x2] == BoundaryFlag::polar_wedge)
-      jl=js+1;
-    if (pmb->pbval->block_bcs[BoundaryFace::outer_x2] == BoundaryFlag::polar
-        || pmb->pbval->block_bcs[BoundaryFace::outer_x2] == BoundaryFlag::polar_wedge)
-      ju=je;
-    for (int j=jl; j<=ju; ++j) {
-      pmb->pcoord->Face2Area(k,j,is,ie,area);
-      pmb->pcoord->Edge3Length(k,j,is,ie+1,len);
+//----------------------------------------------------------------------------------------
+//! \fn  void Field::CTPencil2(const Real wght, const int k, const int j,
+//!                             FaceField &b_out)
+//! \brief CT update of the x2-faces of the pencil (k,j)
+
+void Field::CTPencil2(const Real wght, const int k, const int j, FaceField &b_out) {
+  MeshBlock *pmb=pmy_block;
+  int is = pmb->is; int ie = pmb->ie;
+  AthenaArray<Real> &e1 = e.x1e, &e3 = e.x3e;
+  AthenaArray<Real> &area = face_area_, &len = edge_length_, &len_p1 = edge_length_p1_;
+
+  pmb->pcoord->Face2Area(k,j,is,ie,area);
+  pmb->pcoord->Edge3Length(k,j,is,ie+1,len);
 #pragma omp simd
-      for (int i=is; i<=ie; ++i) {
-        b_out.x2f(k,j,i) += (wght/area(i))*(len(i+1)*e3(k,j,i+1) - len(i)*e3(k,j,i));
-      }
-      if (pmb->block_size.nx3 > 1) {
-        pmb->pcoord->Edge1Length(k  ,j,is,ie,len);
-        pmb->pcoord->Edge1Length(k+1,j,is,ie,len_p1);
+  for (int i=is; i<=ie; ++i) {
+    b_out.x2f(k,j,i) += (wght/area(i))*(len(i+1)*e3(k,j,i+1) - len(i)*e3(k,j,i));
+  }
+  if (pmb->block_size.nx3 > 1) {
+    pmb->pcoord->Edge1Length(k  ,j,is,ie,len);
+    pmb->pcoord->Edge1Length(k+1,j,is,ie,len_p1);
 #pragma omp simd
-        for (int i=is; i<=ie; ++i) {
-          b_out.x2f(k,j,i) -=
-              (wght/area(i))*(len_p1(i)*e1(k+1,j,i) - len(i)*e1(k,j,i));
-        }
-      }
+    for (int i=is; i<=ie; ++i) {
+      b_out.x2f(k,j,i) -=
+          (wght/area(i))*(len_p1(i)*e1(k+1,j,i) - len(i)*e1(k,j,i));
     }
   }
+  return;
+}
 
-  //---- update B3 (curl terms in 1D and 2D problems)
-  for (int k=ks; k<=ke+1; ++k) {
-    for (int j=js; j<=je; ++j) {
-      pmb->pcoord->Face3Area(k,j,is,ie,area);
-      pmb->pcoord->Edge2Length(k,j,is,ie+1,len);
+//----------------------------------------------------------------------------------------
+//! \fn  void Field::CTPencil3(const Real wght, const int k, const int j,
+//!                             FaceField &b_out)
+//! \brief CT update of the x3-faces of the pencil (k,j)
+
+void Field::CTPencil3(const Real wght, const int k, const int j, FaceField &b_out) {
+  MeshBlock *pmb=pmy_block;
+  int is = pmb->is; int ie = pmb->ie;
+  AthenaArray<Real> &e1 = e.x1e, &e2 = e.x2e;
+  AthenaArray<Real> &area = face_area_, &len = edge_length_, &len_p1 = edge_length_p1_;
+
+  pmb->pcoord->Face3Area(k,j,is,ie,area);
+  pmb->pcoord->Edge2Length(k,j,is,ie+1,len);
 #pragma omp simd
-      for (int i=is; i<=ie; ++i) {
-        b_out.x3f(k,j,i) -= (wght/area(i))*(len(i+1)*e2(k,j,i+1) - len(i)*e2(k,j,i));
-      }
-      if (pmb->block_size.nx2 > 1) {
-        pmb->pcoord->Edge1Length(k,j  ,is,ie,len);
-        pmb->pcoord->Edge1Length(k,j+1,is,ie,len_p1);
+  for (int i=is; i<=ie; ++i) {
+    b_out.x3f(k,j,i) -= (wght/area(i))*(len(i+1)*e2(k,j,i+1) - len(i)*e2(k,j,i));
+  }
+  if (pmb->block_size.nx2 > 1) {
+    pmb->pcoord->Edge1Length(k,j  ,is,ie,len);
+    pmb->pcoord->Edge1Length(k,j+1,is,ie,len_p1);
 #pragma omp simd
-        for (int i=is; i<=ie; ++i) {
-          b_out.x3f(k,j,i) +=
-              (wght/area(i))*(len_p1(i)*e1(k,j+1,i) - len(i)*e1(k,j,i));
-        }
-      }
+    for (int i=is; i<=ie; ++i) {
+      b_out.x3f(k,j,i) +=
+          (wght/area(i))*(len_p1(i)*e1(k,j+1,i) - len(i)*e1(k,j,i));
     }
   }
   return;
@@ -63,6 +63,7 @@ class Field {
       const FaceField &bf, AthenaArray<Real> &bc,
       Coordinates *pco, int il, int iu, int jl, int ju, int kl, int ku);
   void CT(const Real wght, FaceField &b_out);
+  void WeightedAveCT(const Real wght_b1[5], const Real wght_b[5], const Real wght);
   void CT_STS(const Real wght, int stage, FaceField &b_out, FaceField &ct_update_out);
   void ComputeCornerE(AthenaArray<Real> &w, AthenaArray<Real> &bcc);
   void ComputeCornerE_STS();
@@ -72,5 +73,10 @@ class Field {
   AthenaArray<Real> cc_e_;
   AthenaArray<Real> face_area_, edge_length_, edge_length_p1_;
   AthenaArray<Real> g_, gi_;  // only used in GR
+
+  void PolarFaceLimits(int &jl, int &ju);
+  void CTPencil1(const Real wght, const int k, const int j, FaceField &b_out);
+  void CTPencil2(const Real wght, const int k, const int j, FaceField &b_out);
+  void CTPencil3(const Real wght, const int k, const int j, FaceField &b_out);
 };
 #endif // FIELD_FIELD_HPP_
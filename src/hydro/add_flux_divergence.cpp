@@ -38,60 +38,114 @@
 // used)
 void Hydro::AddFluxDivergence(const Real wght, AthenaArray<Real> &u_out) {
   MeshBlock *pmb = pmy_block;
+  for (int k=pmb->ks; k<=pmb->ke; ++k) {
+    for (int j=pmb->js; j<=pmb->je; ++j) {
+      AddPencilFluxDivergence(wght, k, j, u_out);
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::WeightedAveFluxDivergence(const Real wght_u1[5],
+//!                                             const Real wght_u[5], const Real wght)
+//! \brief Does the register averages and the flux divergence of a time integrator stage
+//! in one pass over the MeshBlock:
+//!   u1 = WeightedAve(u1, u, u2, u0, fl_div; wght_u1)
+//!   u  = WeightedAve(u, u1, u2, u0, fl_div; wght_u)
+//!   u -= wght*div(flux)
+//!
+//! The three steps are done pencil by pencil, so that the registers are read from and
+//! written to memory once instead of three times. Every cell goes through the same
+//! operations as with the separate sweeps, so the result is bitwise identical. As in
+//! the time integrator, u = u1 (wght_u = {0, 1, 0, ...}) is done by swapping registers.
+
+void Hydro::WeightedAveFluxDivergence(const Real wght_u1[5], const Real wght_u[5],
+                                      const Real wght) {
+  MeshBlock *pmb = pmy_block;
+  const bool swap = (wght_u[0] == 0.0 && wght_u[1] == 1.0 && wght_u[2] == 0.0);
+  AthenaArray<Real> &u_out = swap ? u1 : u;
+
+  for (int k=pmb->ks; k<=pmb->ke; ++k) {
+    for (int j=pmb->js; j<=pmb->je; ++j) {
+      pmb->WeightedAve(u1, u, u2, u0, fl_div, wght_u1, k, k, j, j, pmb->is, pmb->ie);
+      if (!swap)
+        pmb->WeightedAve(u, u1, u2, u0, fl_div, wght_u, k, k, j, j, pmb->is, pmb->ie);
+      AddPencilFluxDivergence(wght, k, j, u_out);
+    }
+  }
+  if (swap) u.SwapAthenaArray(u1);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::AddPencilFluxDivergence(const Real wght, const int k, const int j,
+//!                                           AthenaArray<Real> &u_out)
+//! \brief Adds the flux divergence of the pencil (k,j) to u_out
+
+void Hydro::AddPencilFluxDivergence(const Real wght, const int k, const int j,
+                                    AthenaArray<Real> &u_out) {
+  MeshBlock *pmb = pmy_block;
   AthenaArray<Real> &x1flux = flux[X1DIR];
   AthenaArray<Real> &x2flux = flux[X2DIR];
   AthenaArray<Real> &x3flux = flux[X3DIR];
-  int is = pmb->is; int js = pmb->js; int ks = pmb->ks;
-  int ie = pmb->ie; int je = pmb->je; int ke = pmb->ke;
+  int is = pmb->is; int ie = pmb->ie;
   AthenaArray<Real> &x1area = x1face_area_, &x2area = x2face_area_,
                  &x2area_p1 = x2face_area_p1_, &x3area = x3face_area_,
                  &x3area_p1 = x3face_area_p1_, &vol = cell_volume_, &dflx = dflx_;
 
-  for (int k=ks; k<=ke; ++k) {
-    for (int j=js; j<=je; ++j) {
-      // calculate x1-flux divergence
-      pmb->pcoord->Face1Area(k, j, is, ie+1, x1area);
-      for (int n=0; n<NHYDRO; ++n) {
+  if (pmb->pcoord->GeometryCached()) {
+    pmb->pcoord->CachedFluxDivergence(flux, 0, NHYDRO-1, k, j, is, ie, dflx);
+    for (int n=0; n<NHYDRO; ++n) {
 #pragma omp simd
-        for (int i=is; i<=ie; ++i) {
-          dflx(n,i) = (x1area(i+1)*x1flux(n,k,j,i+1) - x1area(i)*x1flux(n,k,j,i));
-        }
+      for (int i=is; i<=ie; ++i) {
+        u_out(n,k,j,i) -= wght*dflx(n,i);
       }
+    }
+    return;
+  }
 
-      // calculate x2-flux divergence
-      if (pmb->block_size.nx2 > 1) {
-        pmb->pcoord->Face2Area(k, j  , is, ie, x2area   );
-        pmb->pcoord->Face2Area(k, j+1, is, ie, x2area_p1);
-        for (int n=0; n<NHYDRO; ++n) {
+  // calculate x1-flux divergence
+  pmb->pcoord->Face1Area(k, j, is, ie+1, x1area);
+  for (int n=0; n<NHYDRO; ++n) {
 #pragma omp simd
-          for (int i=is; i<=ie; ++i) {
-            dflx(n,i) += (x2area_p1(i)*x2flux(n,k,j+1,i) - x2area(i)*x2flux(n,k,j,i));
-          }
-        }
-      }
+    for (int i=is; i<=ie; ++i) {
+      dflx(n,i) = (x1area(i+1)*x1flux(n,k,j,i+1) - x1area(i)*x1flux(n,k,j,i));
+    }
+  }
 
-      // calculate x3-flux divergence
-      if (pmb->block_size.nx3 > 1) {
-        pmb->pcoord->Face3Area(k  , j, is, ie, x3area   );
-        pmb->pcoord->Face3Area(k+1, j, is, ie, x3area_p1);
-        for (int n=0; n<NHYDRO; ++n) {
+  // calculate x2-flux divergence
+  if (pmb->block_size.nx2 > 1) {
+    pmb->pcoord->Face2Area(k, j  , is, ie, x2area   );
+    pmb->pcoord->Face2Area(k, j+1, is, ie, x2area_p1);
+    for (int n=0; n<NHYDRO; ++n) {
 #pragma omp simd
-          for (int i=is; i<=ie; ++i) {
-            dflx(n,i) += (x3area_p1(i)*x3flux(n,k+1,j,i) - x3area(i)*x3flux(n,k,j,i));
-          }
-        }
+      for (int i=is; i<=ie; ++i) {
+        dflx(n,i) += (x2area_p1(i)*x2flux(n,k,j+1,i) - x2area(i)*x2flux(n,k,j,i));
       }
+    }
+  }
 
-      // update conserved variables
-      pmb->pcoord->CellVolume(k, j, is, ie, vol);
-      for (int n=0; n<NHYDRO; ++n) {
+  // calculate x3-flux divergence
+  if (pmb->block_size.nx3 > 1) {
+    pmb->pcoord->Face3Area(k  , j, is, ie, x3area   );
+    pmb->pcoord->Face3Area(k+1, j, is, ie, x3area_p1);
+    for (int n=0; n<NHYDRO; ++n) {
 #pragma omp simd
-        for (int i=is; i<=ie; ++i) {
-          u_out(n,k,j,i) -= wght*dflx(n,i)/vol(i);
-        }
+      for (int i=is; i<=ie; ++i) {
+        dflx(n,i) += (x3area_p1(i)*x3flux(n,k+1,j,i) - x3area(i)*x3flux(n,k,j,i));
       }
     }
   }
+
+  // update conserved variables
+  pmb->pcoord->CellVolume(k, j, is, ie, vol);
+  for (int n=0; n<NHYDRO; ++n) {
+#pragma omp simd
+    for (int i=is; i<=ie; ++i) {
+      u_out(n,k,j,i) -= wght*dflx(n,i)/vol(i);
+    }
+  }
   return;
 }
 
@@ -116,6 +170,26 @@ void Hydro::AddFluxDivergence_STS(const Real wght, int stage,
                  &x2area_p1 = x2face_area_p1_, &x3area = x3face_area_,
                  &x3area_p1 = x3face_area_p1_, &vol = cell_volume_, &dflx = dflx_;
 
+  if (pmb->pcoord->GeometryCached()) {
+    for (int k=ks; k<=ke; ++k) {
+      for (int j=js; j<=je; ++j) {
+        for (int n=0; n<NHYDRO; ++n) {
+          if (std::binary_search(idx_subset.begin(), idx_subset.end(), n)) {
+            pmb->pcoord->CachedFluxDivergence(flux, n, n, k, j, is, ie, dflx);
+#pragma omp simd
+            for (int i=is; i<=ie; ++i) {
+              u_out(n,k,j,i) -= wght*dflx(n,i);
+              if (stage == 1 && pmb->pmy_mesh->sts_integrator == "rkl2") {
+                fl_div_out(n,k,j,i) = -0.5*pmb->pmy_mesh->dt*dflx(n,i);
+              }
+            }
+          }
+        }
+      }
+    }
+    return;
+  }
+
   for (int k=ks; k<=ke; ++k) {
     for (int j=js; j<=je; ++j) {
       // calculate x1-flux divergence
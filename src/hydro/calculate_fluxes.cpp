@@ -10,6 +10,7 @@
 
 // C++ headers
 #include <algorithm>   // min,max
+#include <cstring>     // strcmp
 
 // Athena++ headers
 #include "../athena.hpp"
@@ -35,7 +36,41 @@
 
 void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
                             AthenaArray<Real> &bcc, const int order) {
+  (this->*flux_pipeline_[order-1])(w, b, bcc);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Hydro::InitFluxPipeline()
+//! \brief fill the table of CalculateFluxesPipeline() instantiations, indexed by the
+//!        reconstruction order minus one, for the coordinate system of this build
+
+void Hydro::InitFluxPipeline() {
+  if (std::strcmp(COORDINATE_SYSTEM, "cartesian") == 0) {
+    flux_pipeline_[0] = &Hydro::CalculateFluxesPipeline<1, true>;
+    flux_pipeline_[1] = &Hydro::CalculateFluxesPipeline<2, true>;
+    flux_pipeline_[2] = &Hydro::CalculateFluxesPipeline<3, true>;
+    flux_pipeline_[3] = &Hydro::CalculateFluxesPipeline<4, true>;
+  } else {
+    flux_pipeline_[0] = &Hydro::CalculateFluxesPipeline<1, false>;
+    flux_pipeline_[1] = &Hydro::CalculateFluxesPipeline<2, false>;
+    flux_pipeline_[2] = &Hydro::CalculateFluxesPipeline<3, false>;
+    flux_pipeline_[3] = &Hydro::CalculateFluxesPipeline<4, false>;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  template <int ORDER, bool CARTESIAN> void Hydro::CalculateFluxesPipeline
+//! \brief Calculate Hydrodynamic Fluxes using the Riemann solver, specialized for the
+//!        reconstruction order and for Cartesian coordinates (whose cell widths are read
+//!        directly instead of through the virtual Coordinates::CenterWidth functions)
+
+template <int ORDER, bool CARTESIAN>
+void Hydro::CalculateFluxesPipeline(AthenaArray<Real> &w, FaceField &b,
+                                    AthenaArray<Real> &bcc) {
   MeshBlock *pmb = pmy_block;
+  Coordinates *pco = pmb->pcoord;
   int is = pmb->is; int js = pmb->js; int ks = pmb->ks;
   int ie = pmb->ie; int je = pmb->je; int ke = pmb->ke;
   int il, iu, jl, ju, kl, ku;
@@ -57,6 +92,10 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
 #endif
   AthenaArray<Real> &flux_fc = scr1_nkji_;
   AthenaArray<Real> &laplacian_all_fc = scr2_nkji_;
+  // the pencils are processed in tiles of at most flux_tile_size cells along x1, so that
+  // the reconstructed states of a tile are still in cache when the Riemann solver reads
+  // them. By default a single tile spans the whole pencil.
+  const int tile = (flux_tile_size > 0) ? flux_tile_size : pmb->ncells1;
 
   //--------------------------------------------------------------------------------------
   // i-direction
@@ -64,7 +103,7 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
   AthenaArray<Real> &x1flux = flux[X1DIR];
   // set the loop limits
   jl = js, ju = je, kl = ks, ku = ke;
-  if (MAGNETIC_FIELDS_ENABLED || order == 4) {
+  if (MAGNETIC_FIELDS_ENABLED || ORDER == 4) {
     if (pmb->block_size.nx2 > 1) {
       if (pmb->block_size.nx3 == 1) // 2D
         jl = js-1, ju = je+1, kl = ks, ku = ke;
@@ -75,36 +114,41 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
 
   for (int k=kl; k<=ku; ++k) {
     for (int j=jl; j<=ju; ++j) {
-      // reconstruct L/R states
-      if (order == 1) {
-        pmb->precon->DonorCellX1(k, j, is-1, ie+1, w, bcc, wl_, wr_);
-      } else if (order == 2) {
-        pmb->precon->PiecewiseLinearX1(k, j, is-1, ie+1, w, bcc, wl_, wr_);
-      } else {
-        pmb->precon->PiecewiseParabolicX1(k, j, is-1, ie+1, w, bcc, wl_, wr_);
-      }
+      for (int i0=is; i0<=ie+1; i0+=tile) {
+        int i1 = std::min(i0+tile-1, ie+1);
+        // reconstruct L/R states
+        if (ORDER == 1) {
+          pmb->precon->DonorCellX1(k, j, i0-1, i1, w, bcc, wl_, wr_);
+        } else if (ORDER == 2) {
+          pmb->precon->PiecewiseLinearX1(k, j, i0-1, i1, w, bcc, wl_, wr_);
+        } else {
+          pmb->precon->PiecewiseParabolicX1(k, j, i0-1, i1, w, bcc, wl_, wr_);
+        }
 
-      pmb->pcoord->CenterWidth1(k, j, is, ie+1, dxw_);
+        // in Cartesian coordinates the cell widths along x1 are dx1f itself
+        if (!CARTESIAN) pco->CenterWidth1(k, j, i0, i1, dxw_);
+        const AthenaArray<Real> &dx1w = CARTESIAN ? pco->dx1f : dxw_;
 #if !MAGNETIC_FIELDS_ENABLED  // Hydro:
-      RiemannSolver(k, j, is, ie+1, IVX, wl_, wr_, x1flux, dxw_);
+        RiemannSolver(k, j, i0, i1, IVX, wl_, wr_, x1flux, dx1w);
 #else  // MHD:
-      // x1flux(IBY) = (v1*b2 - v2*b1) = -EMFZ
-      // x1flux(IBZ) = (v1*b3 - v3*b1) =  EMFY
-      RiemannSolver(k, j, is, ie+1, IVX, b1, wl_, wr_, x1flux, e3x1, e2x1, w_x1f, dxw_);
+        // x1flux(IBY) = (v1*b2 - v2*b1) = -EMFZ
+        // x1flux(IBZ) = (v1*b3 - v3*b1) =  EMFY
+        RiemannSolver(k, j, i0, i1, IVX, b1, wl_, wr_, x1flux, e3x1, e2x1, w_x1f, dx1w);
 #endif
 
-      if (order == 4) {
-        for (int n=0; n<NWAVE; n++) {
-          for (int i=is; i<=ie+1; i++) {
-            wl3d_(n,k,j,i) = wl_(n,i);
-            wr3d_(n,k,j,i) = wr_(n,i);
+        if (ORDER == 4) {
+          for (int n=0; n<NWAVE; n++) {
+            for (int i=i0; i<=i1; i++) {
+              wl3d_(n,k,j,i) = wl_(n,i);
+              wr3d_(n,k,j,i) = wr_(n,i);
+            }
           }
         }
       }
     }
   }
 
-  if (order == 4) {
+  if (ORDER == 4) {
     // TODO(felker): assuming uniform mesh with dx1f=dx2f=dx3f, so this should factor out
     // TODO(felker): also, this may need to be dx1v, since Laplacian is cell-centered
     Real h = pmb->pcoord->dx1f(is);  // pco->dx1f(i); inside loop
@@ -154,7 +198,7 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
         }
       }
     }
-  } // end if (order == 4)
+  } // end if (ORDER == 4)
   //------------------------------------------------------------------------------
   // end x1 fourth-order hydro
 
@@ -165,7 +209,7 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
     AthenaArray<Real> &x2flux = flux[X2DIR];
     // set the loop limits
     il = is-1, iu = ie+1, kl = ks, ku = ke;
-    if (MAGNETIC_FIELDS_ENABLED || order == 4) {
+    if (MAGNETIC_FIELDS_ENABLED || ORDER == 4) {
       if (pmb->block_size.nx3 == 1) // 2D
         kl = ks, ku = ke;
       else // 3D
@@ -173,47 +217,57 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
     }
 
     for (int k=kl; k<=ku; ++k) {
-      // reconstruct the first row
-      if (order == 1) {
-        pmb->precon->DonorCellX2(k, js-1, il, iu, w, bcc, wl_, wr_);
-      } else if (order == 2) {
-        pmb->precon->PiecewiseLinearX2(k, js-1, il, iu, w, bcc, wl_, wr_);
-      } else {
-        pmb->precon->PiecewiseParabolicX2(k, js-1, il, iu, w, bcc, wl_, wr_);
-      }
-      for (int j=js; j<=je+1; ++j) {
-        // reconstruct L/R states at j
-        if (order == 1) {
-          pmb->precon->DonorCellX2(k, j, il, iu, w, bcc, wlb_, wr_);
-        } else if (order == 2) {
-          pmb->precon->PiecewiseLinearX2(k, j, il, iu, w, bcc, wlb_, wr_);
+      for (int i0=il; i0<=iu; i0+=tile) {
+        int i1 = std::min(i0+tile-1, iu);
+        // reconstruct the first row
+        if (ORDER == 1) {
+          pmb->precon->DonorCellX2(k, js-1, i0, i1, w, bcc, wl_, wr_);
+        } else if (ORDER == 2) {
+          pmb->precon->PiecewiseLinearX2(k, js-1, i0, i1, w, bcc, wl_, wr_);
         } else {
-          pmb->precon->PiecewiseParabolicX2(k, j, il, iu, w, bcc, wlb_, wr_);
+          pmb->precon->PiecewiseParabolicX2(k, js-1, i0, i1, w, bcc, wl_, wr_);
         }
+        for (int j=js; j<=je+1; ++j) {
+          // reconstruct L/R states at j
+          if (ORDER == 1) {
+            pmb->precon->DonorCellX2(k, j, i0, i1, w, bcc, wlb_, wr_);
+          } else if (ORDER == 2) {
+            pmb->precon->PiecewiseLinearX2(k, j, i0, i1, w, bcc, wlb_, wr_);
+          } else {
+            pmb->precon->PiecewiseParabolicX2(k, j, i0, i1, w, bcc, wlb_, wr_);
+          }
 
-        pmb->pcoord->CenterWidth2(k, j, il, iu, dxw_);
+          if (CARTESIAN) {
+#pragma omp simd
+            for (int i=i0; i<=i1; ++i)
+              dxw_(i) = pco->dx2f(j);
+          } else {
+            pco->CenterWidth2(k, j, i0, i1, dxw_);
+          }
 #if !MAGNETIC_FIELDS_ENABLED  // Hydro:
-        RiemannSolver(k, j, il, iu, IVY, wl_, wr_, x2flux, dxw_);
+          RiemannSolver(k, j, i0, i1, IVY, wl_, wr_, x2flux, dxw_);
 #else  // MHD:
-        // flx(IBY) = (v2*b3 - v3*b2) = -EMFX
-        // flx(IBZ) = (v2*b1 - v1*b2) =  EMFZ
-        RiemannSolver(k, j, il, iu, IVY, b2, wl_, wr_, x2flux, e1x2, e3x2, w_x2f, dxw_);
+          // flx(IBY) = (v2*b3 - v3*b2) = -EMFX
+          // flx(IBZ) = (v2*b1 - v1*b2) =  EMFZ
+          RiemannSolver(k, j, i0, i1, IVY, b2, wl_, wr_, x2flux, e1x2, e3x2, w_x2f,
+                        dxw_);
 #endif
 
-        if (order == 4) {
-          for (int n=0; n<NWAVE; n++) {
-            for (int i=il; i<=iu; i++) {
-              wl3d_(n,k,j,i) = wl_(n,i);
-              wr3d_(n,k,j,i) = wr_(n,i);
+          if (ORDER == 4) {
+            for (int n=0; n<NWAVE; n++) {
+              for (int i=i0; i<=i1; i++) {
+                wl3d_(n,k,j,i) = wl_(n,i);
+                wr3d_(n,k,j,i) = wr_(n,i);
+              }
             }
           }
-        }
 
-        // swap the arrays for the next step
-        wl_.SwapAthenaArray(wlb_);
+          // swap the arrays for the next step
+          wl_.SwapAthenaArray(wlb_);
+        }
       }
     }
-    if (order == 4) {
+    if (ORDER == 4) {
       // TODO(felker): assuming uniform mesh with dx1f=dx2f=dx3f, so factor this out
       // TODO(felker): also, this may need to be dx2v, since Laplacian is cell-centered
       Real h = pmb->pcoord->dx2f(js);  // pco->dx2f(j); inside loop
@@ -264,7 +318,7 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
           }
         }
       }
-    } // end if (order == 4)
+    } // end if (ORDER == 4)
   }
 
   //--------------------------------------------------------------------------------------
@@ -274,51 +328,61 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
     AthenaArray<Real> &x3flux = flux[X3DIR];
     // set the loop limits
     il = is, iu = ie, jl = js, ju = je;
-    if (MAGNETIC_FIELDS_ENABLED || order == 4) {
+    if (MAGNETIC_FIELDS_ENABLED || ORDER == 4) {
       il = is-1, iu = ie+1, jl = js-1, ju = je+1;
     }
 
     for (int j=jl; j<=ju; ++j) { // this loop ordering is intentional
-      // reconstruct the first row
-      if (order == 1) {
-        pmb->precon->DonorCellX3(ks-1, j, il, iu, w, bcc, wl_, wr_);
-      } else if (order == 2) {
-        pmb->precon->PiecewiseLinearX3(ks-1, j, il, iu, w, bcc, wl_, wr_);
-      } else {
-        pmb->precon->PiecewiseParabolicX3(ks-1, j, il, iu, w, bcc, wl_, wr_);
-      }
-      for (int k=ks; k<=ke+1; ++k) {
-        // reconstruct L/R states at k
-        if (order == 1) {
-          pmb->precon->DonorCellX3(k, j, il, iu, w, bcc, wlb_, wr_);
-        } else if (order == 2) {
-          pmb->precon->PiecewiseLinearX3(k, j, il, iu, w, bcc, wlb_, wr_);
+      for (int i0=il; i0<=iu; i0+=tile) {
+        int i1 = std::min(i0+tile-1, iu);
+        // reconstruct the first row
+        if (ORDER == 1) {
+          pmb->precon->DonorCellX3(ks-1, j, i0, i1, w, bcc, wl_, wr_);
+        } else if (ORDER == 2) {
+          pmb->precon->PiecewiseLinearX3(ks-1, j, i0, i1, w, bcc, wl_, wr_);
         } else {
-          pmb->precon->PiecewiseParabolicX3(k, j, il, iu, w, bcc, wlb_, wr_);
+          pmb->precon->PiecewiseParabolicX3(ks-1, j, i0, i1, w, bcc, wl_, wr_);
         }
+        for (int k=ks; k<=ke+1; ++k) {
+          // reconstruct L/R states at k
+          if (ORDER == 1) {
+            pmb->precon->DonorCellX3(k, j, i0, i1, w, bcc, wlb_, wr_);
+          } else if (ORDER == 2) {
+            pmb->precon->PiecewiseLinearX3(k, j, i0, i1, w, bcc, wlb_, wr_);
+          } else {
+            pmb->precon->PiecewiseParabolicX3(k, j, i0, i1, w, bcc, wlb_, wr_);
+          }
 
-        pmb->pcoord->CenterWidth3(k, j, il, iu, dxw_);
+          if (CARTESIAN) {
+#pragma omp simd
+            for (int i=i0; i<=i1; ++i)
+              dxw_(i) = pco->dx3f(k);
+          } else {
+            pco->CenterWidth3(k, j, i0, i1, dxw_);
+          }
 #if !MAGNETIC_FIELDS_ENABLED  // Hydro:
-        RiemannSolver(k, j, il, iu, IVZ, wl_, wr_, x3flux, dxw_);
+          RiemannSolver(k, j, i0, i1, IVZ, wl_, wr_, x3flux, dxw_);
 #else  // MHD:
-        // flx(IBY) = (v3*b1 - v1*b3) = -EMFY
-        // flx(IBZ) = (v3*b2 - v2*b3) =  EMFX
-        RiemannSolver(k, j, il, iu, IVZ, b3, wl_, wr_, x3flux, e2x3, e1x3, w_x3f, dxw_);
+          // flx(IBY) = (v3*b1 - v1*b3) = -EMFY
+          // flx(IBZ) = (v3*b2 - v2*b3) =  EMFX
+          RiemannSolver(k, j, i0, i1, IVZ, b3, wl_, wr_, x3flux, e2x3, e1x3, w_x3f,
+                        dxw_);
 #endif
-        if (order == 4) {
-          for (int n=0; n<NWAVE; n++) {
-            for (int i=il; i<=iu; i++) {
-              wl3d_(n,k,j,i) = wl_(n,i);
-              wr3d_(n,k,j,i) = wr_(n,i);
+          if (ORDER == 4) {
+            for (int n=0; n<NWAVE; n++) {
+              for (int i=i0; i<=i1; i++) {
+                wl3d_(n,k,j,i) = wl_(n,i);
+                wr3d_(n,k,j,i) = wr_(n,i);
+              }
             }
           }
-        }
 
-        // swap the arrays for the next step
-        wl_.SwapAthenaArray(wlb_);
+          // swap the arrays for the next step
+          wl_.SwapAthenaArray(wlb_);
+        }
       }
     }
-    if (order == 4) {
+    if (ORDER == 4) {
       // TODO(felker): assuming uniform mesh with dx1f=dx2f=dx3f, so factor this out
       // TODO(felker): also, this may need to be dx3v, since Laplacian is cell-centered
       Real h = pmb->pcoord->dx3f(ks);  // pco->dx3f(j); inside loop
@@ -368,7 +432,7 @@ void Hydro::CalculateFluxes(AthenaArray<Real> &w, FaceField &b,
           }
         }
       }
-    } // end if (order == 4)
+    } // end if (ORDER == 4)
   }
 
   if (!STS_ENABLED)
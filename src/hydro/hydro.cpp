@@ -10,6 +10,7 @@
 
 // C++ headers
 #include <algorithm>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -59,6 +60,15 @@ Hydro::Hydro(MeshBlock *pmb, ParameterInput *pin) :
 
   pmb->RegisterMeshBlockData(u);
 
+  flux_tile_size = pin->GetOrAddInteger("hydro", "flux_tile_size", 0);
+  if (flux_tile_size < 0) {
+    std::stringstream msg;
+    msg << "### FATAL ERROR in Hydro constructor" << std::endl
+        << "<hydro>/flux_tile_size = " << flux_tile_size << " must be >= 0" << std::endl;
+    ATHENA_ERROR(msg);
+  }
+  InitFluxPipeline();
+
   // Allocate optional memory primitive/conserved variable registers for time-integrator
   if (pmb->precon->xorder == 4) {
     // fourth-order hydro cell-centered approximations
@@ -97,14 +107,15 @@ Hydro::Hydro(MeshBlock *pmb, ParameterInput *pin) :
     }
   }
 
-  // Allocate memory for scratch arrays
+  // Allocate memory for scratch arrays; the rows of the reconstruction and Riemann solver
+  // scratch arrays are padded, so that all of them have the same alignment
   dt1_.NewAthenaArray(nc1);
   dt2_.NewAthenaArray(nc1);
   dt3_.NewAthenaArray(nc1);
-  dxw_.NewAthenaArray(nc1);
-  wl_.NewAthenaArray(NWAVE, nc1);
-  wr_.NewAthenaArray(NWAVE, nc1);
-  wlb_.NewAthenaArray(NWAVE, nc1);
+  dxw_.NewPaddedAthenaArray(nc1);
+  wl_.NewPaddedAthenaArray(NWAVE, nc1);
+  wr_.NewPaddedAthenaArray(NWAVE, nc1);
+  wlb_.NewPaddedAthenaArray(NWAVE, nc1);
   x1face_area_.NewAthenaArray(nc1+1);
   if (pm->f2) {
     x2face_area_.NewAthenaArray(nc1);
@@ -115,7 +126,7 @@ Hydro::Hydro(MeshBlock *pmb, ParameterInput *pin) :
     x3face_area_p1_.NewAthenaArray(nc1);
   }
   cell_volume_.NewAthenaArray(nc1);
-  dflx_.NewAthenaArray(NHYDRO, nc1);
+  dflx_.NewPaddedAthenaArray(NHYDRO, nc1);
   if (MAGNETIC_FIELDS_ENABLED && RELATIVISTIC_DYNAMICS) { // only used in (SR/GR)MHD
     bb_normal_.NewAthenaArray(nc1);
   }
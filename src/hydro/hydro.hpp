@@ -55,6 +55,10 @@ class Hydro {
   AthenaArray<Real> coarse_cons_, coarse_prim_;
   int refinement_idx{-1};
 
+  // length along x1 of the tiles in which CalculateFluxes() processes the pencils
+  // (<hydro>/flux_tile_size, 0 = whole pencils)
+  int flux_tile_size;
+
   // fourth-order intermediate quantities
   AthenaArray<Real> u_cc, w_cc;      // cell-centered approximations
 
@@ -65,6 +69,8 @@ class Hydro {
   // functions
   void NewBlockTimeStep();    // computes new timestep on a MeshBlock
   void AddFluxDivergence(const Real wght, AthenaArray<Real> &u_out);
+  void WeightedAveFluxDivergence(const Real wght_u1[5], const Real wght_u[5],
+                                 const Real wght);
   void AddFluxDivergence_STS(const Real wght, int stage,
                              AthenaArray<Real> &u_out,
                              AthenaArray<Real> &fl_div_out,
@@ -117,7 +123,17 @@ class Hydro {
 
   TimeStepFunc UserTimeStep_;
 
+  // CalculateFluxes() instantiation for each reconstruction order 1-4
+  void (Hydro::*flux_pipeline_[4])(AthenaArray<Real> &w, FaceField &b,
+                                   AthenaArray<Real> &bcc);
+
+  void InitFluxPipeline();
+  template <int ORDER, bool CARTESIAN>
+  void CalculateFluxesPipeline(AthenaArray<Real> &w, FaceField &b,
+                               AthenaArray<Real> &bcc);
   void AddDiffusionFluxes();
+  void AddPencilFluxDivergence(const Real wght, const int k, const int j,
+                               AthenaArray<Real> &u_out);
   Real GetWeightForCT(Real dflx, Real rhol, Real rhor, Real dx, Real dt);
 };
 #endif // HYDRO_HYDRO_HPP_
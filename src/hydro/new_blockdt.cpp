@@ -61,73 +61,81 @@ void Hydro::NewBlockTimeStep() {
 
   // TODO(felker): skip this next loop if pm->fluid_setup == FluidFormulation::disabled
   FluidFormulation fluid_status = pmb->pmy_mesh->fluid_setup;
+  // the signal speeds in all active directions and their minimum are computed in a single
+  // pass over each x1-slice, without storing dt1, dt2, dt3 in between
+  const bool x2_active = (pmb->block_size.nx2 > 1), x3_active = (pmb->block_size.nx3 > 1);
   for (int k=ks; k<=ke; ++k) {
     for (int j=js; j<=je; ++j) {
       pmb->pcoord->CenterWidth1(k, j, is, ie, dt1);
       pmb->pcoord->CenterWidth2(k, j, is, ie, dt2);
       pmb->pcoord->CenterWidth3(k, j, is, ie, dt3);
-      if (!RELATIVISTIC_DYNAMICS) {
-#pragma ivdep
+      if (RELATIVISTIC_DYNAMICS) {
+        // compute minimum of cell widths (signal speeds are bounded by c = 1)
+#pragma omp simd reduction(min:min_dt_hyperbolic)
+        for (int i=is; i<=ie; ++i) {
+          Real dt_i = dt1(i);
+          if (x2_active) dt_i = std::min(dt_i, dt2(i));
+          if (x3_active) dt_i = std::min(dt_i, dt3(i));
+          min_dt_hyperbolic = std::min(min_dt_hyperbolic, dt_i);
+        }
+      } else if (fluid_status != FluidFormulation::evolve) {
+        // FluidFormulation::background or disabled. Assume scalar advection:
+#pragma omp simd reduction(min:min_dt_hyperbolic)
+        for (int i=is; i<=ie; ++i) {
+          Real dt_i = dt1(i) / std::abs(w(IVX,k,j,i));
+          if (x2_active) dt_i = std::min(dt_i, dt2(i) / std::abs(w(IVY,k,j,i)));
+          if (x3_active) dt_i = std::min(dt_i, dt3(i) / std::abs(w(IVZ,k,j,i)));
+          min_dt_hyperbolic = std::min(min_dt_hyperbolic, dt_i);
+        }
+      } else if (MAGNETIC_FIELDS_ENABLED) {
+        // compute minimum of (v +/- C_f) over active directions
+        AthenaArray<Real> &bcc = pmb->pfield->bcc, &b_x1f = pmb->pfield->b.x1f,
+                        &b_x2f = pmb->pfield->b.x2f, &b_x3f = pmb->pfield->b.x3f;
+#pragma omp simd private(wi) reduction(min:min_dt_hyperbolic)
         for (int i=is; i<=ie; ++i) {
           wi[IDN] = w(IDN,k,j,i);
           wi[IVX] = w(IVX,k,j,i);
           wi[IVY] = w(IVY,k,j,i);
           wi[IVZ] = w(IVZ,k,j,i);
           if (NON_BAROTROPIC_EOS) wi[IPR] = w(IPR,k,j,i);
-          if (fluid_status == FluidFormulation::evolve) {
-            if (MAGNETIC_FIELDS_ENABLED) {
-              AthenaArray<Real> &bcc = pmb->pfield->bcc, &b_x1f = pmb->pfield->b.x1f,
-                              &b_x2f = pmb->pfield->b.x2f, &b_x3f = pmb->pfield->b.x3f;
-              Real bx = bcc(IB1,k,j,i) + std::abs(b_x1f(k,j,i) - bcc(IB1,k,j,i));
-              wi[IBY] = bcc(IB2,k,j,i);
-              wi[IBZ] = bcc(IB3,k,j,i);
-              Real cf = pmb->peos->FastMagnetosonicSpeed(wi,bx);
-              dt1(i) /= (std::abs(wi[IVX]) + cf);
-
-              wi[IBY] = bcc(IB3,k,j,i);
-              wi[IBZ] = bcc(IB1,k,j,i);
-              bx = bcc(IB2,k,j,i) + std::abs(b_x2f(k,j,i) - bcc(IB2,k,j,i));
-              cf = pmb->peos->FastMagnetosonicSpeed(wi,bx);
-              dt2(i) /= (std::abs(wi[IVY]) + cf);
-
-              wi[IBY] = bcc(IB1,k,j,i);
-              wi[IBZ] = bcc(IB2,k,j,i);
-              bx = bcc(IB3,k,j,i) + std::abs(b_x3f(k,j,i) - bcc(IB3,k,j,i));
-              cf = pmb->peos->FastMagnetosonicSpeed(wi,bx);
-              dt3(i) /= (std::abs(wi[IVZ]) + cf);
-            } else {
-              Real cs = pmb->peos->SoundSpeed(wi);
-              dt1(i) /= (std::abs(wi[IVX]) + cs);
-              dt2(i) /= (std::abs(wi[IVY]) + cs);
-              dt3(i) /= (std::abs(wi[IVZ]) + cs);
-            }
-          } else { // FluidFormulation::background or disabled. Assume scalar advection:
-            dt1(i) /= (std::abs(wi[IVX]));
-            dt2(i) /= (std::abs(wi[IVY]));
-            dt3(i) /= (std::abs(wi[IVZ]));
-          }
-        }
-      }
 
-      // compute minimum of (v1 +/- C)
-      for (int i=is; i<=ie; ++i) {
-        Real& dt_1 = dt1(i);
-        min_dt_hyperbolic = std::min(min_dt_hyperbolic, dt_1);
-      }
+          Real bx = bcc(IB1,k,j,i) + std::abs(b_x1f(k,j,i) - bcc(IB1,k,j,i));
+          wi[IBY] = bcc(IB2,k,j,i);
+          wi[IBZ] = bcc(IB3,k,j,i);
+          Real cf = pmb->peos->FastMagnetosonicSpeed(wi,bx);
+          Real dt_i = dt1(i) / (std::abs(wi[IVX]) + cf);
+
+          if (x2_active) {
+            wi[IBY] = bcc(IB3,k,j,i);
+            wi[IBZ] = bcc(IB1,k,j,i);
+            bx = bcc(IB2,k,j,i) + std::abs(b_x2f(k,j,i) - bcc(IB2,k,j,i));
+            cf = pmb->peos->FastMagnetosonicSpeed(wi,bx);
+            dt_i = std::min(dt_i, dt2(i) / (std::abs(wi[IVY]) + cf));
+          }
 
-      // if grid is 2D/3D, compute minimum of (v2 +/- C)
-      if (pmb->block_size.nx2 > 1) {
-        for (int i=is; i<=ie; ++i) {
-          Real& dt_2 = dt2(i);
-          min_dt_hyperbolic = std::min(min_dt_hyperbolic, dt_2);
+          if (x3_active) {
+            wi[IBY] = bcc(IB1,k,j,i);
+            wi[IBZ] = bcc(IB2,k,j,i);
+            bx = bcc(IB3,k,j,i) + std::abs(b_x3f(k,j,i) - bcc(IB3,k,j,i));
+            cf = pmb->peos->FastMagnetosonicSpeed(wi,bx);
+            dt_i = std::min(dt_i, dt3(i) / (std::abs(wi[IVZ]) + cf));
+          }
+          min_dt_hyperbolic = std::min(min_dt_hyperbolic, dt_i);
         }
-      }
-
-      // if grid is 3D, compute minimum of (v3 +/- C)
-      if (pmb->block_size.nx3 > 1) {
+      } else {
+        // compute minimum of (v +/- C_s) over active directions
+#pragma omp simd private(wi) reduction(min:min_dt_hyperbolic)
         for (int i=is; i<=ie; ++i) {
-          Real& dt_3 = dt3(i);
-          min_dt_hyperbolic = std::min(min_dt_hyperbolic, dt_3);
+          wi[IDN] = w(IDN,k,j,i);
+          wi[IVX] = w(IVX,k,j,i);
+          wi[IVY] = w(IVY,k,j,i);
+          wi[IVZ] = w(IVZ,k,j,i);
+          if (NON_BAROTROPIC_EOS) wi[IPR] = w(IPR,k,j,i);
+          Real cs = pmb->peos->SoundSpeed(wi);
+          Real dt_i = dt1(i) / (std::abs(wi[IVX]) + cs);
+          if (x2_active) dt_i = std::min(dt_i, dt2(i) / (std::abs(wi[IVY]) + cs));
+          if (x3_active) dt_i = std::min(dt_i, dt3(i) / (std::abs(wi[IVZ]) + cs));
+          min_dt_hyperbolic = std::min(min_dt_hyperbolic, dt_i);
         }
       }
     }
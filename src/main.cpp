@@ -42,6 +42,8 @@
 #include "outputs/io_wrapper.hpp"
 #include "outputs/outputs.hpp"
 #include "parameter_input.hpp"
+#include "task_list/task_profiler.hpp"
+#include "utils/memory_pool.hpp"
 #include "utils/utils.hpp"
 
 // MPI/OpenMP headers
@@ -263,6 +265,10 @@ int main(int argc, char *argv[]) {
   //--- Step 4. --------------------------------------------------------------------------
   // Construct and initialize Mesh
 
+  // AthenaArray data is drawn from the pool allocator from now on, if requested
+  if (pinput->GetOrAddBoolean("mesh", "memory_pool", false))
+    MemoryPool::Enable();
+
   Mesh *pmesh;
 #ifdef ENABLE_EXCEPTIONS
   try {
@@ -596,11 +602,19 @@ int main(int argc, char *argv[]) {
 #endif
   }
 
+  // write the task profile and timeline of each rank
+  if (pmesh->ptprof != nullptr) pmesh->ptprof->Write();
+
   delete pinput;
   delete pmesh;
   delete ptlist;
   delete pouts;
 
+  if (MemoryPool::IsEnabled()) {
+    MemoryPool::OutputStatistics();
+    MemoryPool::ReleaseCache();
+  }
+
 #ifdef MPI_PARALLEL
   MPI_Finalize();
 #endif
@@ -12,7 +12,12 @@
 #include <algorithm>  // std::sort()
 #include <cstdint>
 #include <iostream>
+#include <limits>
+#include <set>
 #include <sstream>
+#include <string>
+#include <utility>    // pair
+#include <vector>
 
 // Athena++ headers
 #include "../athena.hpp"
@@ -39,6 +44,8 @@ void Mesh::LoadBalancingAndAdaptiveMeshRefinement(ParameterInput *pin) {
   int nnew = 0, ndel = 0;
   amr_updated = false;
 
+  MeasureLoadImbalance();
+
   if (adaptive) {
     UpdateMeshBlockTree(nnew, ndel);
     nbnew += nnew; nbdel += ndel;
@@ -63,11 +70,19 @@ void Mesh::LoadBalancingAndAdaptiveMeshRefinement(ParameterInput *pin) {
 
 //----------------------------------------------------------------------------------------
 //! \fn void Mesh::CalculateLoadBalance(double *clist, int *rlist, int *slist,
-//!                                     int *nlist, int nb)
+//!                                     int *nlist, int nb, const int *rkeep)
 //! \brief Calculate distribution of MeshBlocks based on the cost list
+//!
+//! Every rank gets a contiguous range of GIDs, i.e. a segment of the space-filling curve
+//! (<loadbalancing>/sfc = zorder or hilbert). The default partitioner greedily splits the
+//! cost list. With <loadbalancing>/partitioner = surface, the split is then improved by
+//! minimizing the max over the ranks of their cost plus the faces they share with other
+//! ranks (see PartitionCost()). rkeep, if given, is the current rank of every MeshBlock;
+//! it is kept unless the new distribution is better by more than
+//! <loadbalancing>/min_improvement.
 
 void Mesh::CalculateLoadBalance(double *clist, int *rlist, int *slist, int *nlist,
-                                int nb) {
+                                int nb, const int *rkeep) {
   std::stringstream msg;
   double real_max  =  std::numeric_limits<double>::max();
   double totalcost = 0, maxcost = 0.0, mincost = (real_max);
@@ -98,6 +113,30 @@ void Mesh::CalculateLoadBalance(double *clist, int *rlist, int *slist, int *nlis
       targetcost = totalcost/(j+1);
     }
   }
+
+  if (Globals::nranks > 1 && (lb_surface_ || (rkeep != nullptr
+                                              && lb_min_improvement_ > 0.0))) {
+    std::vector<int> xadj, adj;
+    std::vector<double> rcost;
+    if (lb_surface_) {
+      GetFaceNeighborList(nb, xadj, adj);
+      MinimizePartitionCost(clist, rlist, nb, xadj, adj);
+    }
+    if (rkeep != nullptr && lb_min_improvement_ > 0.0) {
+      // the current distribution is only valid if every rank still has a MeshBlock
+      std::vector<int> nkeep(Globals::nranks, 0);
+      for (int i=0; i<nb; i++)
+        nkeep[rkeep[i]]++;
+      if (std::find(nkeep.begin(), nkeep.end(), 0) == nkeep.end()
+          && PartitionCost(clist, rkeep, nb, xadj, adj, rcost)
+          <= (1.0 + lb_min_improvement_)*PartitionCost(clist, rlist, nb, xadj, adj,
+                                                       rcost)) {
+        for (int i=0; i<nb; i++)
+          rlist[i] = rkeep[i];
+      }
+    }
+  }
+
   slist[0] = 0;
   j = 0;
   for (int i=1; i<nb; i++) { // make the list of nbstart and nblocks
@@ -108,13 +147,16 @@ void Mesh::CalculateLoadBalance(double *clist, int *rlist, int *slist, int *nlis
   }
   nlist[j] = nb-slist[j];
 
-  if (Globals::my_rank == 0) {
-    for (int i=0; i<Globals::nranks; i++) {
-      double rcost = 0.0;
-      for(int n=slist[i]; n<slist[i]+nlist[i]; n++)
-        rcost += clist[n];
-    }
+  double rmax = 0.0, rsum = 0.0;
+  for (int i=0; i<Globals::nranks; i++) {
+    double rcost = 0.0;
+    for (int n=slist[i]; n<slist[i]+nlist[i]; n++)
+      rcost += clist[n];
+    rmax = std::max(rmax, rcost);
+    rsum += rcost;
   }
+  if (rsum > 0.0)
+    lb_predicted_ = rmax*Globals::nranks/rsum;
 
 #ifdef MPI_PARALLEL
   if (nb % (Globals::nranks * num_mesh_threads_) != 0
@@ -133,6 +175,247 @@ void Mesh::CalculateLoadBalance(double *clist, int *rlist, int *slist, int *nlis
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::SetLoadBalancePolicy(ParameterInput *pin)
+//! \brief read the MeshBlock ordering and the partitioner from <loadbalancing>
+
+void Mesh::SetLoadBalancePolicy(ParameterInput *pin) {
+  std::stringstream msg;
+  // the ordering defines the GIDs in the restart files, so it is read without MPI too
+  std::string sfc = pin->GetOrAddString("loadbalancing", "sfc", "zorder");
+  if (sfc == "hilbert") {
+    lb_hilbert_ = true;
+  } else if (sfc != "zorder") {
+    msg << "### FATAL ERROR in Mesh::SetLoadBalancePolicy" << std::endl
+        << "Unknown <loadbalancing>/sfc = " << sfc << std::endl;
+    ATHENA_ERROR(msg);
+  }
+#ifdef MPI_PARALLEL
+  std::string partitioner = pin->GetOrAddString("loadbalancing", "partitioner",
+                                                "greedy");
+  if (partitioner == "surface") {
+    lb_surface_ = true;
+  } else if (partitioner != "greedy") {
+    msg << "### FATAL ERROR in Mesh::SetLoadBalancePolicy" << std::endl
+        << "Unknown <loadbalancing>/partitioner = " << partitioner << std::endl;
+    ATHENA_ERROR(msg);
+  }
+  if (lb_surface_) {
+    // cost of a face shared with another rank, in units of the mean MeshBlock cost
+    lb_surface_weight_ = pin->GetOrAddReal("loadbalancing", "surface_weight", 0.05);
+    // factor for faces shared with another rank on the same node
+    lb_intranode_weight_ = pin->GetOrAddReal("loadbalancing", "intranode_weight", 0.5);
+    // identify the node of every rank by its lowest rank
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, Globals::my_rank,
+                        MPI_INFO_NULL, &node_comm);
+    int node = Globals::my_rank;
+    MPI_Bcast(&node, 1, MPI_INT, 0, node_comm);
+    MPI_Comm_free(&node_comm);
+    lb_node_.resize(Globals::nranks);
+    MPI_Allgather(&node, 1, MPI_INT, lb_node_.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  }
+  lb_min_improvement_ = pin->GetOrAddReal("loadbalancing", "min_improvement",
+                                          lb_surface_ ? 0.05 : 0.0);
+  lb_diagnostics_ = pin->GetOrAddBoolean("loadbalancing", "diagnostics", lb_surface_);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::GetFaceNeighborList(int nb, std::vector<int> &xadj,
+//!                                    std::vector<int> &adj)
+//! \brief list the MeshBlocks sharing a face with each MeshBlock, using the GIDs of the
+//!        last MeshBlockTree::GetMeshBlockList(); the neighbors of n are
+//!        adj[xadj[n]:xadj[n+1]-1]. The list is symmetric.
+
+void Mesh::GetFaceNeighborList(int nb, std::vector<int> &xadj, std::vector<int> &adj) {
+  int nleaf = 1 << ndim;
+  std::vector<MeshBlockTree*> leaves;
+  std::vector<std::vector<int>> nbr(nb);
+  tree.GetLeafList(leaves);
+  for (MeshBlockTree *bt : leaves) {
+    int n = bt->gid_;
+    for (int dir=0; dir<2*ndim; dir++) {
+      int ox[3] = {0, 0, 0};
+      ox[dir/2] = (dir%2 == 0) ? -1 : 1;
+      MeshBlockTree *nt = tree.FindNeighbor(bt->loc_, ox[0], ox[1], ox[2]);
+      if (nt == nullptr) continue;
+      if (nt->pleaf_ == nullptr) {
+        if (nt->gid_ != n) nbr[n].push_back(nt->gid_);
+      } else { // finer neighbors: the leaves of nt touching the face
+        int side = (ox[dir/2] < 0) ? 1 : 0;
+        for (int l=0; l<nleaf; l++) {
+          if (((l >> (dir/2)) & 1) != side) continue;
+          MeshBlockTree *lt = nt->pleaf_[l];
+          if (lt != nullptr && lt->pleaf_ == nullptr)
+            nbr[n].push_back(lt->gid_);
+        }
+      }
+    }
+  }
+  xadj.assign(nb+1, 0);
+  for (int n=0; n<nb; n++)
+    xadj[n+1] = xadj[n] + static_cast<int>(nbr[n].size());
+  adj.resize(xadj[nb]);
+  for (int n=0; n<nb; n++)
+    std::copy(nbr[n].begin(), nbr[n].end(), adj.begin() + xadj[n]);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn double Mesh::PartitionCost(const double *clist, const int *rlist, int nb,
+//!                     const std::vector<int> &xadj, const std::vector<int> &adj,
+//!                     std::vector<double> &rcost)
+//! \brief cost of every rank and their maximum for the distribution rlist
+//!
+//! The cost of a rank is the sum of the costs of its MeshBlocks plus surface_weight x
+//! the mean MeshBlock cost for every face shared with a MeshBlock of another rank
+//! (x intranode_weight if that rank is on the same node). adj may be empty.
+
+double Mesh::PartitionCost(const double *clist, const int *rlist, int nb,
+                           const std::vector<int> &xadj, const std::vector<int> &adj,
+                           std::vector<double> &rcost) {
+  double totalcost = 0.0;
+  rcost.assign(Globals::nranks, 0.0);
+  for (int n=0; n<nb; n++) {
+    rcost[rlist[n]] += clist[n];
+    totalcost += clist[n];
+  }
+  if (!adj.empty()) {
+    double wface = lb_surface_weight_*totalcost/nb;
+    bool nodes = (static_cast<int>(lb_node_.size()) == Globals::nranks);
+    for (int n=0; n<nb; n++) {
+      int r = rlist[n];
+      for (int i=xadj[n]; i<xadj[n+1]; i++) {
+        int q = rlist[adj[i]];
+        if (q != r)
+          rcost[r] += (nodes && lb_node_[q] == lb_node_[r]) ? lb_intranode_weight_*wface
+                                                            : wface;
+      }
+    }
+  }
+  return *std::max_element(rcost.begin(), rcost.end());
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::MinimizePartitionCost(const double *clist, int *rlist, int nb,
+//!                     const std::vector<int> &xadj, const std::vector<int> &adj)
+//! \brief local search for the contiguous distribution minimizing PartitionCost()
+//!
+//! Starting from rlist, the most expensive rank repeatedly hands its first or last
+//! MeshBlock to the neighboring rank along the curve, as long as all the ranks whose
+//! cost changes end up cheaper than it was. Every rank keeps at least one MeshBlock,
+//! and the ranks stay contiguous and ordered.
+
+void Mesh::MinimizePartitionCost(const double *clist, int *rlist, int nb,
+                                 const std::vector<int> &xadj,
+                                 const std::vector<int> &adj) {
+  const int nranks = Globals::nranks;
+  std::vector<double> rcost, tcost(nranks);
+  std::vector<int> first(nranks), count(nranks, 0);
+  double totalcost = 0.0;
+  PartitionCost(clist, rlist, nb, xadj, adj, rcost);
+  for (int n=nb-1; n>=0; n--) {
+    first[rlist[n]] = n;
+    count[rlist[n]]++;
+    totalcost += clist[n];
+  }
+  if (std::find(count.begin(), count.end(), 0) != count.end()) return;
+  const double wface = adj.empty() ? 0.0 : lb_surface_weight_*totalcost/nb;
+  const bool nodes = (static_cast<int>(lb_node_.size()) == nranks);
+  auto face = [&](int r, int q) {
+    return (nodes && lb_node_[q] == lb_node_[r]) ? lb_intranode_weight_*wface : wface;
+  };
+  // changes of the rank costs if MeshBlock n moves to rank b
+  std::vector<std::pair<int, double>> delta[2];
+  auto change = [&](int n, int b, std::vector<std::pair<int, double>> &d) {
+    int a = rlist[n];
+    d.clear();
+    d.emplace_back(a, -clist[n]);
+    d.emplace_back(b, clist[n]);
+    for (int i=xadj[n]; i<xadj[n+1]; i++) {
+      int q = rlist[adj[i]];
+      if (q != a) {
+        d.emplace_back(a, -face(a, q));
+        d.emplace_back(q, -face(q, a));
+      }
+      if (q != b) {
+        d.emplace_back(b, face(b, q));
+        d.emplace_back(q, face(q, b));
+      }
+    }
+    for (auto &x : d)
+      tcost[x.first] = rcost[x.first];
+    for (auto &x : d)
+      tcost[x.first] += x.second;
+    double tmax = 0.0;
+    for (auto &x : d)
+      tmax = std::max(tmax, tcost[x.first]);
+    return tmax;
+  };
+  // the ranks ordered by cost
+  std::set<std::pair<double, int>> order;
+  for (int r=0; r<nranks; r++)
+    order.emplace(rcost[r], r);
+
+  for (int iter=0; iter<4*nb; iter++) {
+    int r = order.rbegin()->second;
+    if (count[r] < 2) break;
+    int best = -1;
+    double bmax = rcost[r];
+    for (int d=0; d<2; d++) { // 0: first MeshBlock to rank r-1, 1: last to rank r+1
+      int b = (d == 0) ? r-1 : r+1;
+      if (b < 0 || b >= nranks) continue;
+      double tmax = change((d == 0) ? first[r] : first[r]+count[r]-1, b, delta[d]);
+      if (tmax < bmax) best = d, bmax = tmax;
+    }
+    if (best < 0) break;
+    for (auto &x : delta[best])
+      order.erase(std::make_pair(rcost[x.first], x.first));
+    for (auto &x : delta[best])
+      rcost[x.first] += x.second;
+    for (auto &x : delta[best])
+      order.emplace(rcost[x.first], x.first);
+    if (best == 0) {
+      rlist[first[r]] = r-1;
+      count[r-1]++;
+      first[r]++;
+    } else {
+      rlist[first[r]+count[r]-1] = r+1;
+      first[r+1]--;
+      count[r+1]++;
+    }
+    count[r]--;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::MeasureLoadImbalance()
+//! \brief collect the time measured in the MeshBlocks of this rank, and every
+//!        ncycle_out cycles the measured max/mean over the ranks for
+//!        OutputCycleDiagnostics()
+
+void Mesh::MeasureLoadImbalance() {
+  if (!lb_diagnostics_) return;
+  for (int i=0; i<nblocal; ++i) {
+    lb_busy_time_ += my_blocks(i)->busy_time_;
+    my_blocks(i)->busy_time_ = 0.0;
+  }
+  if (ncycle_out != 0 && ncycle % ncycle_out == 0) {
+    double tmax = lb_busy_time_, tsum = lb_busy_time_;
+#ifdef MPI_PARALLEL
+    MPI_Reduce(&lb_busy_time_, &tmax, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&lb_busy_time_, &tsum, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+#endif
+    if (tsum > 0.0)
+      lb_achieved_ = tmax*Globals::nranks/tsum;
+    lb_busy_time_ = 0.0;
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void Mesh::ResetLoadBalanceVariables()
 //! \brief reset counters and flags for load balancing
@@ -249,27 +532,19 @@ void Mesh::UpdateMeshBlockTree(int &nnew, int &ndel) {
   // calculate the list of the newly derefined blocks
   int ctnd = 0;
   if (tnderef >= nleaf) {
-    int lk = 0, lj = 0;
-    if (mesh_size.nx2 > 1) lj = 1;
-    if (mesh_size.nx3 > 1) lk = 1;
     for (int n=0; n<tnderef; n++) {
       if ((lderef[n].lx1 & 1LL) == 0LL &&
           (lderef[n].lx2 & 1LL) == 0LL &&
           (lderef[n].lx3 & 1LL) == 0LL) {
-        int r = n, rr = 0;
-        for (std::int64_t k=0; k<=lk; k++) {
-          for (std::int64_t j=0; j<=lj; j++) {
-            for (std::int64_t i=0; i<=1; i++) {
-              if (r < tnderef) {
-                if ((lderef[n].lx1+i) == lderef[r].lx1
-                    && (lderef[n].lx2+j) == lderef[r].lx2
-                    && (lderef[n].lx3+k) == lderef[r].lx3
-                    &&  lderef[n].level  == lderef[r].level)
-                  rr++;
-                r++;
-              }
-            }
-          }
+        // the siblings are contiguous in the GID order, but only with Z-ordering is the
+        // first of them the one with even logical coordinates
+        int rr = 0;
+        for (int r=std::max(n-nleaf+1, 0); r<std::min(n+nleaf, tnderef); r++) {
+          if ((lderef[n].lx1>>1) == (lderef[r].lx1>>1)
+              && (lderef[n].lx2>>1) == (lderef[r].lx2>>1)
+              && (lderef[n].lx3>>1) == (lderef[r].lx3>>1)
+              &&  lderef[n].level   == lderef[r].level)
+            rr++;
         }
         if (rr == nleaf) {
           clderef[ctnd].lx1   = lderef[n].lx1>>1;
@@ -392,8 +667,28 @@ void Mesh::RedistributeAndRefineMeshBlocks(ParameterInput *pin, int ntot) {
     }
   }
 
-  // Step 2. Calculate new load balance
-  CalculateLoadBalance(newcost, newrank, nslist, nblist, ntot);
+  // Step 2. Calculate new load balance, or keep the current ranks (no migration)
+  int *keeprank = new int[ntot];
+  for (int n=0; n<ntot; n++)
+    keeprank[n] = ranklist[newtoold[n]];
+  CalculateLoadBalance(newcost, newrank, nslist, nblist, ntot, keeprank);
+  delete [] keeprank;
+
+  if (ntot == nbtold) {
+    // nothing to do if the tree is unchanged and every MeshBlock stays on its rank
+    bool moved = false;
+    for (int n=0; n<ntot; n++)
+      moved = moved || (newtoold[n] != n) || (newrank[n] != ranklist[n]);
+    if (!moved) {
+      delete [] newloc;
+      delete [] newrank;
+      delete [] newcost;
+      delete [] newtoold;
+      delete [] oldtonew;
+      ResetLoadBalanceVariables();
+      return;
+    }
+  }
 
   int nbs = nslist[Globals::my_rank];
   int nbe = nbs + nblist[Globals::my_rank] - 1;
@@ -29,6 +29,7 @@
 #include "../athena.hpp"
 #include "../athena_arrays.hpp"
 #include "../bvals/bvals.hpp"
+#include "../bvals/bvals_coalesced.hpp"
 #include "../coordinates/coordinates.hpp"
 #include "../eos/eos.hpp"
 #include "../fft/athena_fft.hpp"
@@ -47,7 +48,9 @@
 #include "../parameter_input.hpp"
 #include "../reconstruct/reconstruction.hpp"
 #include "../scalars/scalars.hpp"
+#include "../task_list/task_profiler.hpp"
 #include "../utils/buffer_utils.hpp"
+#include "../utils/compression.hpp"
 #include "mesh.hpp"
 #include "mesh_refinement.hpp"
 #include "meshblock_tree.hpp"
@@ -100,6 +103,8 @@ Mesh::Mesh(ParameterInput *pin, int mesh_test) :
     muj(), nuj(), muj_tilde(), gammaj_tilde(),
     nbnew(), nbdel(),
     step_since_lb(), gflag(), turb_flag(), amr_updated(multilevel),
+    direct_boundary_copy(pin->GetOrAddBoolean("mesh", "direct_boundary_copy", true)),
+    ptprof(), pcbcomm(),
     // private members:
     next_phys_id_(), num_mesh_threads_(pin->GetOrAddInteger("mesh", "num_threads", 1)),
     gids_(), gide_(),
@@ -108,6 +113,9 @@ Mesh::Mesh(ParameterInput *pin, int mesh_test) :
     nreal_user_mesh_data_(), nint_user_mesh_data_(), nuser_history_output_(),
     four_pi_G_(), grav_eps_(-1.0),
     lb_flag_(true), lb_automatic_(), lb_manual_(),
+    lb_hilbert_(), lb_surface_(), lb_diagnostics_(), lb_surface_weight_(),
+    lb_intranode_weight_(1.0), lb_min_improvement_(),
+    lb_predicted_(-1.0), lb_achieved_(-1.0), lb_busy_time_(),
     MeshGenerator_{UniformMeshGeneratorX1, UniformMeshGeneratorX2,
                    UniformMeshGeneratorX3},
     BoundaryFunction_{nullptr, nullptr, nullptr, nullptr, nullptr, nullptr},
@@ -304,6 +312,7 @@ Mesh::Mesh(ParameterInput *pin, int mesh_test) :
   lb_tolerance_ = pin->GetOrAddReal("loadbalancing","tolerance",0.5);
   lb_interval_ = pin->GetOrAddReal("loadbalancing","interval",10);
 #endif
+  SetLoadBalancePolicy(pin);
 
   // SMR / AMR:
   if (adaptive) {
@@ -520,6 +529,21 @@ Mesh::Mesh(ParameterInput *pin, int mesh_test) :
   }
 
 
+  // the profiler must exist before the task lists are created
+  if (pin->GetOrAddBoolean("profiler", "tasks", false))
+    ptprof = new TaskProfiler(pin, num_mesh_threads_);
+#ifdef MPI_PARALLEL
+  if (pin->GetOrAddBoolean("mesh", "coalesce_boundary_mpi", false)) {
+    pcbcomm = new CoalescedBoundaryComm(
+        this, pin->GetOrAddBoolean("mesh", "single_precision_boundary_mpi", false));
+  } else if (pin->GetOrAddBoolean("mesh", "single_precision_boundary_mpi", false)) {
+    msg << "### FATAL ERROR in Mesh constructor" << std::endl
+        << "<mesh>/single_precision_boundary_mpi = true requires "
+        << "<mesh>/coalesce_boundary_mpi = true." << std::endl;
+    ATHENA_ERROR(msg);
+  }
+#endif
+
   if (SELF_GRAVITY_ENABLED == 1) {
     gflag = 1; // set gravity flag
     pfgrd = new FFTGravityDriver(this, pin);
@@ -593,6 +617,8 @@ Mesh::Mesh(ParameterInput *pin, IOWrapper& resfile, int mesh_test) :
     muj(), nuj(), muj_tilde(), gammaj_tilde(),
     nbnew(), nbdel(),
     step_since_lb(), gflag(), turb_flag(), amr_updated(multilevel),
+    direct_boundary_copy(pin->GetOrAddBoolean("mesh", "direct_boundary_copy", true)),
+    ptprof(), pcbcomm(),
     // private members:
     next_phys_id_(), num_mesh_threads_(pin->GetOrAddInteger("mesh", "num_threads", 1)),
     gids_(), gide_(),
@@ -601,6 +627,9 @@ Mesh::Mesh(ParameterInput *pin, IOWrapper& resfile, int mesh_test) :
     nreal_user_mesh_data_(), nint_user_mesh_data_(), nuser_history_output_(),
     four_pi_G_(), grav_eps_(-1.0),
     lb_flag_(true), lb_automatic_(), lb_manual_(),
+    lb_hilbert_(), lb_surface_(), lb_diagnostics_(), lb_surface_weight_(),
+    lb_intranode_weight_(1.0), lb_min_improvement_(),
+    lb_predicted_(-1.0), lb_achieved_(-1.0), lb_busy_time_(),
     MeshGenerator_{UniformMeshGeneratorX1, UniformMeshGeneratorX2,
                    UniformMeshGeneratorX3},
     BoundaryFunction_{nullptr, nullptr, nullptr, nullptr, nullptr, nullptr},
@@ -710,6 +739,7 @@ Mesh::Mesh(ParameterInput *pin, IOWrapper& resfile, int mesh_test) :
   lb_tolerance_ = pin->GetOrAddReal("loadbalancing", "tolerance", 0.5);
   lb_interval_ = pin->GetOrAddReal("loadbalancing", "interval", 10);
 #endif
+  SetLoadBalancePolicy(pin);
 
   // SMR / AMR
   if (adaptive) {
@@ -800,13 +830,23 @@ Mesh::Mesh(ParameterInput *pin, IOWrapper& resfile, int mesh_test) :
     tree.AddMeshBlockWithoutRefine(loclist[i]);
   int nnb;
   // check the tree structure, and assign GID
-  tree.GetMeshBlockList(loclist, nullptr, nnb);
+  LogicalLocation *treeloc = new LogicalLocation[nbtotal];
+  tree.GetMeshBlockList(treeloc, nullptr, nnb);
   if (nnb != nbtotal) {
     msg << "### FATAL ERROR in Mesh constructor" << std::endl
         << "Tree reconstruction failed. The total numbers of the blocks do not match. ("
         << nbtotal << " != " << nnb << ")" << std::endl;
     ATHENA_ERROR(msg);
   }
+  for (int i=0; i<nbtotal; i++) {
+    if (!(treeloc[i] == loclist[i])) {
+      msg << "### FATAL ERROR in Mesh constructor" << std::endl
+          << "The MeshBlocks in the restart file are not ordered as specified by "
+          << "<loadbalancing>/sfc." << std::endl;
+      ATHENA_ERROR(msg);
+    }
+  }
+  delete [] treeloc;
 
 #ifdef MPI_PARALLEL
   if (nbtotal < Globals::nranks) {
@@ -845,6 +885,21 @@ Mesh::Mesh(ParameterInput *pin, IOWrapper& resfile, int mesh_test) :
     return;
   }
 
+  // the profiler must exist before the task lists are created
+  if (pin->GetOrAddBoolean("profiler", "tasks", false))
+    ptprof = new TaskProfiler(pin, num_mesh_threads_);
+#ifdef MPI_PARALLEL
+  if (pin->GetOrAddBoolean("mesh", "coalesce_boundary_mpi", false)) {
+    pcbcomm = new CoalescedBoundaryComm(
+        this, pin->GetOrAddBoolean("mesh", "single_precision_boundary_mpi", false));
+  } else if (pin->GetOrAddBoolean("mesh", "single_precision_boundary_mpi", false)) {
+    msg << "### FATAL ERROR in Mesh constructor" << std::endl
+        << "<mesh>/single_precision_boundary_mpi = true requires "
+        << "<mesh>/coalesce_boundary_mpi = true." << std::endl;
+    ATHENA_ERROR(msg);
+  }
+#endif
+
   if (SELF_GRAVITY_ENABLED == 1) {
     gflag = 1; // set gravity flag
     pfgrd = new FFTGravityDriver(this, pin);
@@ -862,8 +917,15 @@ Mesh::Mesh(ParameterInput *pin, IOWrapper& resfile, int mesh_test) :
   char *mbdata = new char[datasize*nblocal];
   my_blocks.NewAthenaArray(nblocal);
   // load MeshBlocks (parallel)
-  if (resfile.Read_at_all(mbdata, datasize, nblocal, headeroffset+gids_*datasize) !=
-      static_cast<unsigned int>(nblocal)) {
+  int format_version = pin->GetOrAddInteger("restart", "format_version", 1);
+  if (format_version == 2) {
+    ReadCompressedMeshBlocks(resfile, headeroffset, datasize, mbdata);
+  } else if (format_version != 1) {
+    msg << "### FATAL ERROR in Mesh constructor" << std::endl
+        << "Unknown restart file format version " << format_version << "." << std::endl;
+    ATHENA_ERROR(msg);
+  } else if (resfile.Read_at_all(mbdata, datasize, nblocal, headeroffset+gids_*datasize)
+             != static_cast<unsigned int>(nblocal)) {
     msg << "### FATAL ERROR in Mesh constructor" << std::endl
         << "The restart file is broken or input parameters are inconsistent."
         << std::endl;
@@ -895,6 +957,67 @@ Mesh::Mesh(ParameterInput *pin, IOWrapper& resfile, int mesh_test) :
     ptrbd = new TurbulenceDriver(this, pin);
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::ReadCompressedMeshBlocks(IOWrapper &resfile, IOWrapperSizeT offset,
+//!                                         IOWrapperSizeT datasize, char *mbdata)
+//! \brief read the MeshBlocks gids_ to gide_ from a restart file in format version 2,
+//!        where offset is the position of the offset table (see RestartOutput), and
+//!        decompress them into mbdata after verifying their checksums
+
+void Mesh::ReadCompressedMeshBlocks(IOWrapper &resfile, IOWrapperSizeT offset,
+                                    IOWrapperSizeT datasize, char *mbdata) {
+  std::stringstream msg;
+  IOWrapperSizeT tablesize = 3*sizeof(std::uint64_t);
+  std::vector<std::uint64_t> index(3*nblocal);
+  if (resfile.Read_at_all(index.data(), tablesize, nblocal, offset+gids_*tablesize)
+      != static_cast<unsigned int>(nblocal)) {
+    msg << "### FATAL ERROR in Mesh::ReadCompressedMeshBlocks" << std::endl
+        << "The offset table of the restart file is broken." << std::endl;
+    ATHENA_ERROR(msg);
+  }
+  // the MeshBlocks of a rank are contiguous in the file
+  std::uint64_t start = index[0];
+  std::uint64_t size = index[3*(nblocal-1)] + index[3*(nblocal-1)+1] - start;
+  char *cdata = new char[size];
+  if (resfile.Read_at_all(cdata, 1, size, offset+nbtotal*tablesize+start) != size) {
+    msg << "### FATAL ERROR in Mesh::ReadCompressedMeshBlocks" << std::endl
+        << "The restart file is broken." << std::endl;
+    ATHENA_ERROR(msg);
+  }
+
+  // decompress (threaded) and flag the corrupt MeshBlocks
+  std::vector<int> corrupt(nblocal, 0);
+#pragma omp parallel for num_threads(num_mesh_threads_)
+  for (int b=0; b<nblocal; ++b) {
+    char *pdata = &(mbdata[b*datasize]);
+    if (index[3*b] < start || index[3*b] - start + index[3*b+1] > size
+        || !BlockCompression::Decompress(&(cdata[index[3*b]-start]), index[3*b+1],
+                                         sizeof(Real), pdata, datasize)
+        || BlockCompression::Checksum(pdata, datasize) != index[3*b+2])
+      corrupt[b] = 1;
+  }
+  delete [] cdata;
+  // all ranks stop, so that none of them is left waiting in the collective file close
+  int nbad = 0, firstbad = -1;
+  for (int b=nblocal-1; b>=0; --b) {
+    if (corrupt[b]) {
+      nbad++;
+      firstbad = gids_ + b;
+    }
+  }
+#ifdef MPI_PARALLEL
+  MPI_Allreduce(MPI_IN_PLACE, &nbad, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  if (nbad > 0) {
+    msg << "### FATAL ERROR in Mesh::ReadCompressedMeshBlocks" << std::endl
+        << nbad << " MeshBlock(s) in the restart file are corrupt (checksum mismatch)";
+    if (firstbad >= 0) msg << ", the first one on this rank is " << firstbad;
+    msg << "." << std::endl;
+    ATHENA_ERROR(msg);
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! destructor
 
@@ -909,6 +1032,10 @@ Mesh::~Mesh() {
   if (SELF_GRAVITY_ENABLED == 1) delete pfgrd;
   else if (SELF_GRAVITY_ENABLED == 2) delete pmgrd;
   if (turb_flag > 0) delete ptrbd;
+  delete ptprof;
+#ifdef MPI_PARALLEL
+  delete pcbcomm;
+#endif
   if (adaptive) { // deallocate arrays for AMR
     delete [] nref;
     delete [] nderef;
@@ -1389,6 +1516,9 @@ void Mesh::Initialize(int res_flag, ParameterInput *pin) {
       ptrbd->Driving();
 
     // Create send/recv MPI_Requests for all BoundaryData objects
+#ifdef MPI_PARALLEL
+    if (pcbcomm != nullptr) pcbcomm->ClearParts();
+#endif
 #pragma omp parallel for num_threads(nthreads)
     for (int i=0; i<nblocal; ++i) {
       MeshBlock *pmb = my_blocks(i);
@@ -1398,6 +1528,9 @@ void Mesh::Initialize(int res_flag, ParameterInput *pin) {
       if (SELF_GRAVITY_ENABLED == 1)
         pmb->pgrav->gbvar.SetupPersistentMPI();
     }
+#ifdef MPI_PARALLEL
+    if (pcbcomm != nullptr) pcbcomm->BuildMessages();
+#endif
 
     // solve gravity for the first time
     if (SELF_GRAVITY_ENABLED == 1)
@@ -1953,6 +2086,13 @@ void Mesh::OutputCycleDiagnostics() {
                     << std::setprecision(dt_precision);
         }
       } // else (empty): dt_diagnostics = -1 -> provide no additional timestep diagnostics
+      if (lb_diagnostics_) {
+        std::cout << "\nload imbalance (max/mean): predicted="
+                  << std::setprecision(ratio_precision) << lb_predicted_;
+        if (lb_achieved_ > 0.0)
+          std::cout << " achieved=" << lb_achieved_;
+        std::cout << std::setprecision(dt_precision);
+      }
       std::cout << std::endl;
     }
   }
@@ -37,6 +37,7 @@ class MeshRefinement;
 class MeshBlockTree;
 class BoundaryValues;
 class CellCenteredBoundaryVariable;
+class CoalescedBoundaryComm;
 class FaceCenteredBoundaryVariable;
 class TaskList;
 struct TaskStates;
@@ -52,6 +53,7 @@ class EquationOfState;
 class FFTDriver;
 class FFTGravityDriver;
 class TurbulenceDriver;
+class TaskProfiler;
 class OrbitalAdvection;
 
 FluidFormulation GetFluidFormulation(const std::string& input_string);
@@ -128,6 +130,11 @@ class MeshBlock {
                   AthenaArray<Real> &u_in1, AthenaArray<Real> &u_in2,
                   AthenaArray<Real> &u_in3, AthenaArray<Real> &u_in4,
                   const Real wght[5]);
+  void WeightedAve(AthenaArray<Real> &u_out,
+                   AthenaArray<Real> &u_in1, AthenaArray<Real> &u_in2,
+                   AthenaArray<Real> &u_in3, AthenaArray<Real> &u_in4,
+                   const Real wght[5], const int kl, const int ku, const int jl,
+                   const int ju, const int il, const int iu);
   void WeightedAve(FaceField &b_out,
                    FaceField &b_in1, FaceField &b_in2,
                    FaceField &b_in3, FaceField &b_in4,
@@ -139,6 +146,9 @@ class MeshBlock {
   void RegisterMeshBlockData(AthenaArray<Real> &pvar_cc);
   void RegisterMeshBlockData(FaceField &pvar_fc);
 
+  //! called by neighbors on the same rank after they deliver boundary data to this block
+  void NotifyBoundaryArrival() { tasks.Notify(); }
+
   //! defined in either the prob file or default_pgen.cpp in ../pgen/
   void UserWorkBeforeOutput(ParameterInput *pin); // called in Mesh fn (friend class)
   void UserWorkInLoop();                          // called in TimeIntegratorTaskList
@@ -169,6 +179,7 @@ class MeshBlock {
 
   // functions and variables for automatic load balancing based on timing
   double cost_, lb_time_;
+  double busy_time_; // time measured since the last Mesh::MeasureLoadImbalance()
   void ResetTimeMeasurement();
   void StartTimeMeasurement();
   void StopTimeMeasurement();
@@ -237,6 +248,7 @@ class Mesh {
   int gflag;
   int turb_flag; // turbulence flag
   bool amr_updated;
+  bool direct_boundary_copy; // pack same-rank boundary data into the target recv buffer
   EosTable *peos_table;
 
   AthenaArray<MeshBlock*> my_blocks;
@@ -244,6 +256,8 @@ class Mesh {
   TurbulenceDriver *ptrbd;
   FFTGravityDriver *pfgrd;
   MGGravityDriver *pmgrd;
+  TaskProfiler *ptprof; // nullptr unless <profiler>/tasks = true
+  CoalescedBoundaryComm *pcbcomm; // nullptr unless <mesh>/coalesce_boundary_mpi = true
 
   AthenaArray<Real> *ruser_mesh_data;
   AthenaArray<int> *iuser_mesh_data;
@@ -306,6 +320,13 @@ class Mesh {
   bool lb_flag_, lb_automatic_, lb_manual_;
   double lb_tolerance_;
   int lb_interval_;
+  // load balancing policy: MeshBlock ordering and partitioner, see CalculateLoadBalance()
+  bool lb_hilbert_, lb_surface_, lb_diagnostics_;
+  double lb_surface_weight_, lb_intranode_weight_, lb_min_improvement_;
+  std::vector<int> lb_node_; // shared-memory node of each MPI rank
+  // max/mean cost of the ranks: predicted by the partitioner, and measured since the
+  // last cycle diagnostics (negative if not available)
+  double lb_predicted_, lb_achieved_, lb_busy_time_;
 
   // functions
   MeshGenFunc MeshGenerator_[3];
@@ -324,7 +345,18 @@ class Mesh {
   void AllocateRealUserMeshDataField(int n);
   void AllocateIntUserMeshDataField(int n);
   void OutputMeshStructure(int dim);
-  void CalculateLoadBalance(double *clist, int *rlist, int *slist, int *nlist, int nb);
+  void ReadCompressedMeshBlocks(IOWrapper &resfile, IOWrapperSizeT offset,
+                                IOWrapperSizeT datasize, char *mbdata);
+  void CalculateLoadBalance(double *clist, int *rlist, int *slist, int *nlist, int nb,
+                            const int *rkeep=nullptr);
+  void SetLoadBalancePolicy(ParameterInput *pin);
+  void GetFaceNeighborList(int nb, std::vector<int> &xadj, std::vector<int> &adj);
+  double PartitionCost(const double *clist, const int *rlist, int nb,
+                       const std::vector<int> &xadj, const std::vector<int> &adj,
+                       std::vector<double> &rcost);
+  void MinimizePartitionCost(const double *clist, int *rlist, int nb,
+                             const std::vector<int> &xadj, const std::vector<int> &adj);
+  void MeasureLoadImbalance();
   void ResetLoadBalanceVariables();
 
   void CorrectMidpointInitialCondition();
@@ -51,7 +51,7 @@ MeshBlock::MeshBlock(int igid, int ilid, LogicalLocation iloc, RegionSize input_
     gid(igid), lid(ilid), gflag(igflag), nuser_out_var(),
     new_block_dt_{}, new_block_dt_hyperbolic_{}, new_block_dt_parabolic_{},
     new_block_dt_user_{},
-    nreal_user_meshblock_data_(), nint_user_meshblock_data_(), cost_(1.0) {
+    nreal_user_meshblock_data_(), nint_user_meshblock_data_(), cost_(1.0), busy_time_() {
   // initialize grid indices
   is = NGHOST;
   ie = is + block_size.nx1 - 1;
@@ -118,6 +118,7 @@ MeshBlock::MeshBlock(int igid, int ilid, LogicalLocation iloc, RegionSize input_
   } else if (std::strcmp(COORDINATE_SYSTEM, "gr_user") == 0) {
     pcoord = new GRUser(this, pin, false);
   }
+  pcoord->CacheGeometry(pin);
 
   // Reconstruction: constructor may implicitly depend on Coordinates, and PPM variable
   // floors depend on EOS, but EOS isn't needed in Reconstruction constructor-> this is ok
@@ -196,7 +197,8 @@ MeshBlock::MeshBlock(int igid, int ilid, Mesh *pm, ParameterInput *pin,
     gid(igid), lid(ilid), gflag(igflag), nuser_out_var(),
     new_block_dt_{}, new_block_dt_hyperbolic_{}, new_block_dt_parabolic_{},
     new_block_dt_user_{},
-    nreal_user_meshblock_data_(), nint_user_meshblock_data_(), cost_(icost) {
+    nreal_user_meshblock_data_(), nint_user_meshblock_data_(), cost_(icost),
+    busy_time_() {
   // initialize grid indices
   is = NGHOST;
   ie = is + block_size.nx1 - 1;
@@ -256,6 +258,7 @@ MeshBlock::MeshBlock(int igid, int ilid, Mesh *pm, ParameterInput *pin,
   } else if (std::strcmp(COORDINATE_SYSTEM, "gr_user") == 0) {
     pcoord = new GRUser(this, pin, false);
   }
+  pcoord->CacheGeometry(pin);
 
   // Reconstruction (constructor may implicitly depend on Coordinates)
   precon = new Reconstruction(this, pin);
@@ -487,7 +490,7 @@ void MeshBlock::ResetTimeMeasurement() {
 //! \brief start time measurement for automatic load balancing
 
 void MeshBlock::StartTimeMeasurement() {
-  if (pmy_mesh->lb_automatic_) {
+  if (pmy_mesh->lb_automatic_ || pmy_mesh->lb_diagnostics_) {
 #ifdef OPENMP_PARALLEL
     lb_time_ = omp_get_wtime();
 #else
@@ -501,13 +504,14 @@ void MeshBlock::StartTimeMeasurement() {
 //! \brief stop time measurement and accumulate it in the MeshBlock cost
 
 void MeshBlock::StopTimeMeasurement() {
-  if (pmy_mesh->lb_automatic_) {
+  if (pmy_mesh->lb_automatic_ || pmy_mesh->lb_diagnostics_) {
 #ifdef OPENMP_PARALLEL
     lb_time_ = omp_get_wtime() - lb_time_;
 #else
     lb_time_ = static_cast<double>(clock()) - lb_time_;
 #endif
-    cost_ += lb_time_;
+    if (pmy_mesh->lb_automatic_) cost_ += lb_time_;
+    busy_time_ += lb_time_;
   }
 }
 
@@ -15,10 +15,13 @@
 // C headers
 
 // C++ headers
+#include <algorithm>  // sort, min
 #include <cstdint>    // int64_t
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <utility>    // pair
+#include <vector>
 
 // Athena++ headers
 #include "../athena.hpp"
@@ -300,7 +303,10 @@ void MeshBlockTree::Derefine(int &ndel) {
     }
   }
 
-  gid_ = pleaf_[0]->gid_; // now this is a leaf; inherit the first leaf's GID
+  // now this is a leaf; inherit the first GID of the leaves (pleaf_[0] with Z-ordering)
+  gid_ = pleaf_[0]->gid_;
+  for (int n=1; n<nleaf_; n++)
+    gid_ = std::min(gid_, pleaf_[n]->gid_);
   for (int n=0; n<nleaf_; n++)
     delete pleaf_[n];
   delete [] pleaf_;
@@ -330,10 +336,30 @@ void MeshBlockTree::CountMeshBlock(int& count) {
 //----------------------------------------------------------------------------------------
 //! \fn void MeshBlockTree::GetMeshBlockList(LogicalLocation *list,
 //!                                          int *pglist, int& count)
-//! \brief creates the Location list sorted by Z-ordering
+//! \brief creates the Location list sorted by Z-ordering, or by Hilbert ordering with
+//!        <loadbalancing>/sfc = hilbert
 
 void MeshBlockTree::GetMeshBlockList(LogicalLocation *list, int *pglist, int& count) {
-  if (loc_.level == 0) count=0;
+  if (loc_.level == 0) {
+    count=0;
+    if (pmesh_->lb_hilbert_) {
+      std::vector<MeshBlockTree*> leaves;
+      GetLeafList(leaves);
+      std::vector<std::pair<std::uint64_t, MeshBlockTree*>> key(leaves.size());
+      for (std::size_t n=0; n<leaves.size(); n++)
+        key[n] = std::make_pair(HilbertKey(leaves[n]->loc_), leaves[n]);
+      std::sort(key.begin(), key.end());
+      for (auto &k : key) {
+        MeshBlockTree *bt = k.second;
+        list[count]=bt->loc_;
+        if (pglist != nullptr)
+          pglist[count]=bt->gid_;
+        bt->gid_=count;
+        count++;
+      }
+      return;
+    }
+  }
 
   if (pleaf_ == nullptr) {
     list[count]=loc_;
@@ -350,6 +376,80 @@ void MeshBlockTree::GetMeshBlockList(LogicalLocation *list, int *pglist, int& co
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlockTree::GetLeafList(std::vector<MeshBlockTree*> &leaves)
+//! \brief appends the leaves of this node in Z-ordering
+
+void MeshBlockTree::GetLeafList(std::vector<MeshBlockTree*> &leaves) {
+  if (pleaf_ == nullptr) {
+    leaves.push_back(this);
+  } else {
+    for (int n=0; n<nleaf_; n++) {
+      if (pleaf_[n] != nullptr)
+        pleaf_[n]->GetLeafList(leaves);
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn std::uint64_t MeshBlockTree::HilbertKey(const LogicalLocation &loc)
+//! \brief position of the lower corner of a MeshBlock along the Hilbert curve that fills
+//!        the logical root block with 2^b cells per direction
+//!
+//! b = 63/ndim is fixed, so that the key of a MeshBlock does not depend on the current
+//! refinement. Every node of the tree covers a contiguous range of keys, hence any of
+//! its cells orders it correctly. This uses the transposition of J. Skilling, AIP Conf.
+//! Proc. 707, 381 (2004); in 1D the Hilbert and Z-ordering are identical.
+
+std::uint64_t MeshBlockTree::HilbertKey(const LogicalLocation &loc) {
+  int ndim = 1;
+  if (pmesh_->f2) ndim = 2;
+  if (pmesh_->f3) ndim = 3;
+  const int b = 63/ndim;
+  if (loc.level > b) {
+    std::stringstream msg;
+    msg << "### FATAL ERROR in MeshBlockTree::HilbertKey" << std::endl
+        << "<loadbalancing>/sfc = hilbert supports at most " << b
+        << " logical levels in " << ndim << "D." << std::endl;
+    ATHENA_ERROR(msg);
+  }
+  std::uint64_t x[3] = {static_cast<std::uint64_t>(loc.lx1) << (b - loc.level),
+                        static_cast<std::uint64_t>(loc.lx2) << (b - loc.level),
+                        static_cast<std::uint64_t>(loc.lx3) << (b - loc.level)};
+  if (ndim == 1) return x[0];
+  const std::uint64_t m = static_cast<std::uint64_t>(1) << (b - 1);
+  // inverse undo
+  for (std::uint64_t q=m; q>1; q>>=1) {
+    std::uint64_t p = q - 1;
+    for (int i=0; i<ndim; i++) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        std::uint64_t t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  // Gray encode
+  for (int i=1; i<ndim; i++)
+    x[i] ^= x[i-1];
+  std::uint64_t t = 0;
+  for (std::uint64_t q=m; q>1; q>>=1) {
+    if (x[ndim-1] & q) t ^= q - 1;
+  }
+  for (int i=0; i<ndim; i++)
+    x[i] ^= t;
+  // interleave the transposed bits, most significant first
+  std::uint64_t key = 0;
+  for (int q=b-1; q>=0; q--) {
+    for (int i=0; i<ndim; i++)
+      key = (key << 1) | ((x[i] >> q) & 1);
+  }
+  return key;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn MeshBlockTree* MeshBlockTree::FindNeighbor(LogicalLocation myloc,
 //!                                   int ox1, int ox2, int ox3, bool amrflag)
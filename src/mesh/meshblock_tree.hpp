@@ -12,6 +12,7 @@
 // C headers
 
 // C++ headers
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -51,6 +52,7 @@ class MeshBlockTree {
   MeshBlockTree* FindMeshBlock(LogicalLocation tloc);
   void CountMeshBlock(int& count);
   void GetMeshBlockList(LogicalLocation *list, int *pglist, int& count);
+  void GetLeafList(std::vector<MeshBlockTree*> &leaves);
   MeshBlockTree* FindNeighbor(LogicalLocation myloc, int ox1, int ox2, int ox3,
                               bool amrflag=false);
   void CountMGOctets(int *noct);
@@ -66,6 +68,8 @@ class MeshBlockTree {
   static Mesh* pmesh_;
   static MeshBlockTree* proot_;
   static int nleaf_;
+
+  static std::uint64_t HilbertKey(const LogicalLocation &loc);
 };
 
 #endif // MESH_MESHBLOCK_TREE_HPP_
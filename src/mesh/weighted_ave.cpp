@@ -33,6 +33,24 @@
 void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
                             AthenaArray<Real> &u_in2, AthenaArray<Real> &u_in3,
                             AthenaArray<Real> &u_in4, const Real wght[5]) {
+  WeightedAve(u_out, u_in1, u_in2, u_in3, u_in4, wght, ks, ke, js, je, is, ie);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
+//!          AthenaArray<Real> &u_in2, AthenaArray<Real> &u_in3, AthenaArray<Real> &u_in4,
+//!          const Real wght[5], const int kl, const int ku, const int jl, const int ju,
+//!          const int il, const int iu)
+//! \brief Same as above over the index range [kl,ku]x[jl,ju]x[il,iu] of all nx4
+//!        variables. The fused stage updates call it for single pencils, and it also
+//!        works on the 3D component arrays of a FaceField.
+
+void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
+                            AthenaArray<Real> &u_in2, AthenaArray<Real> &u_in3,
+                            AthenaArray<Real> &u_in4, const Real wght[5],
+                            const int kl, const int ku, const int jl, const int ju,
+                            const int il, const int iu) {
   const int nu = u_out.GetDim4() - 1;
 
   // u_in2, u_in3, and/or u_in4 may be unallocated AthenaArrays if using a
@@ -40,10 +58,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
   if (wght[0] == 1.0) {
     if (wght[4] != 0.0) {
       for (int n=0; n<=nu; ++n) {
-        for (int k=ks; k<=ke; ++k) {
-          for (int j=js; j<=je; ++j) {
+        for (int k=kl; k<=ku; ++k) {
+          for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-            for (int i=is; i<=ie; ++i) {
+            for (int i=il; i<=iu; ++i) {
               u_out(n,k,j,i) += wght[1]*u_in1(n,k,j,i) + wght[2]*u_in2(n,k,j,i)
                                 + wght[3]*u_in3(n,k,j,i) + wght[4]*u_in4(n,k,j,i);
             }
@@ -53,10 +71,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
     } else { // do not dereference u_in4
       if (wght[3] != 0.0) {
         for (int n=0; n<=nu; ++n) {
-          for (int k=ks; k<=ke; ++k) {
-            for (int j=js; j<=je; ++j) {
+          for (int k=kl; k<=ku; ++k) {
+            for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-              for (int i=is; i<=ie; ++i) {
+              for (int i=il; i<=iu; ++i) {
                 u_out(n,k,j,i) += wght[1]*u_in1(n,k,j,i) + wght[2]*u_in2(n,k,j,i)
                                   + wght[3]*u_in3(n,k,j,i);
               }
@@ -66,10 +84,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
       } else { // do not dereference u_in3
         if (wght[2] != 0.0) {
           for (int n=0; n<=nu; ++n) {
-            for (int k=ks; k<=ke; ++k) {
-              for (int j=js; j<=je; ++j) {
+            for (int k=kl; k<=ku; ++k) {
+              for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-                for (int i=is; i<=ie; ++i) {
+                for (int i=il; i<=iu; ++i) {
                   u_out(n,k,j,i) += wght[1]*u_in1(n,k,j,i) + wght[2]*u_in2(n,k,j,i);
                 }
               }
@@ -78,10 +96,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
         } else { // do not dereference u_in2
           if (wght[1] != 0.0) {
             for (int n=0; n<=nu; ++n) {
-              for (int k=ks; k<=ke; ++k) {
-                for (int j=js; j<=je; ++j) {
+              for (int k=kl; k<=ku; ++k) {
+                for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-                  for (int i=is; i<=ie; ++i) {
+                  for (int i=il; i<=iu; ++i) {
                     u_out(n,k,j,i) += wght[1]*u_in1(n,k,j,i);
                   }
                 }
@@ -94,10 +112,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
   } else if (wght[0] == 0.0) {
     if (wght[4] != 0.0) {
       for (int n=0; n<=nu; ++n) {
-        for (int k=ks; k<=ke; ++k) {
-          for (int j=js; j<=je; ++j) {
+        for (int k=kl; k<=ku; ++k) {
+          for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-            for (int i=is; i<=ie; ++i) {
+            for (int i=il; i<=iu; ++i) {
               u_out(n,k,j,i) = wght[1]*u_in1(n,k,j,i) + wght[2]*u_in2(n,k,j,i)
                                + wght[3]*u_in3(n,k,j,i) + wght[4]*u_in4(n,k,j,i);
             }
@@ -107,10 +125,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
     } else {
       if (wght[3] != 0.0) {
         for (int n=0; n<=nu; ++n) {
-          for (int k=ks; k<=ke; ++k) {
-            for (int j=js; j<=je; ++j) {
+          for (int k=kl; k<=ku; ++k) {
+            for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-              for (int i=is; i<=ie; ++i) {
+              for (int i=il; i<=iu; ++i) {
                 u_out(n,k,j,i) = wght[1]*u_in1(n,k,j,i) + wght[2]*u_in2(n,k,j,i)
                                  + wght[3]*u_in3(n,k,j,i);
               }
@@ -120,10 +138,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
       } else {
         if (wght[2] != 0.0) {
           for (int n=0; n<=nu; ++n) {
-            for (int k=ks; k<=ke; ++k) {
-              for (int j=js; j<=je; ++j) {
+            for (int k=kl; k<=ku; ++k) {
+              for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-                for (int i=is; i<=ie; ++i) {
+                for (int i=il; i<=iu; ++i) {
                   u_out(n,k,j,i) = wght[1]*u_in1(n,k,j,i) + wght[2]*u_in2(n,k,j,i);
                 }
               }
@@ -133,10 +151,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
           if (wght[1] == 1.0) {
             // just deep copy
             for (int n=0; n<=nu; ++n) {
-              for (int k=ks; k<=ke; ++k) {
-                for (int j=js; j<=je; ++j) {
+              for (int k=kl; k<=ku; ++k) {
+                for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-                  for (int i=is; i<=ie; ++i) {
+                  for (int i=il; i<=iu; ++i) {
                     u_out(n,k,j,i) = u_in1(n,k,j,i);
                   }
                 }
@@ -144,10 +162,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
             }
           } else {
             for (int n=0; n<=nu; ++n) {
-              for (int k=ks; k<=ke; ++k) {
-                for (int j=js; j<=je; ++j) {
+              for (int k=kl; k<=ku; ++k) {
+                for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-                  for (int i=is; i<=ie; ++i) {
+                  for (int i=il; i<=iu; ++i) {
                     u_out(n,k,j,i) = wght[1]*u_in1(n,k,j,i);
                   }
                 }
@@ -160,10 +178,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
   } else {
     if (wght[4] != 0.0) {
       for (int n=0; n<=nu; ++n) {
-        for (int k=ks; k<=ke; ++k) {
-          for (int j=js; j<=je; ++j) {
+        for (int k=kl; k<=ku; ++k) {
+          for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-            for (int i=is; i<=ie; ++i) {
+            for (int i=il; i<=iu; ++i) {
               u_out(n,k,j,i) = wght[0]*u_out(n,k,j,i) + wght[1]*u_in1(n,k,j,i)
                                + wght[2]*u_in2(n,k,j,i) + wght[3]*u_in3(n,k,j,i)
                                + wght[4]*u_in4(n,k,j,i);
@@ -174,10 +192,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
     } else { // do not dereference u_in4
       if (wght[3] != 0.0) {
         for (int n=0; n<=nu; ++n) {
-          for (int k=ks; k<=ke; ++k) {
-            for (int j=js; j<=je; ++j) {
+          for (int k=kl; k<=ku; ++k) {
+            for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-              for (int i=is; i<=ie; ++i) {
+              for (int i=il; i<=iu; ++i) {
                 u_out(n,k,j,i) = wght[0]*u_out(n,k,j,i) + wght[1]*u_in1(n,k,j,i)
                                  + wght[2]*u_in2(n,k,j,i) + wght[3]*u_in3(n,k,j,i);
               }
@@ -187,10 +205,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
       } else { // do not dereference u_in3
         if (wght[2] != 0.0) {
           for (int n=0; n<=nu; ++n) {
-            for (int k=ks; k<=ke; ++k) {
-              for (int j=js; j<=je; ++j) {
+            for (int k=kl; k<=ku; ++k) {
+              for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-                for (int i=is; i<=ie; ++i) {
+                for (int i=il; i<=iu; ++i) {
                   u_out(n,k,j,i) = wght[0]*u_out(n,k,j,i) + wght[1]*u_in1(n,k,j,i)
                                + wght[2]*u_in2(n,k,j,i);
                 }
@@ -200,10 +218,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
         } else { // do not dereference u_in2
           if (wght[1] != 0.0) {
             for (int n=0; n<=nu; ++n) {
-              for (int k=ks; k<=ke; ++k) {
-                for (int j=js; j<=je; ++j) {
+              for (int k=kl; k<=ku; ++k) {
+                for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-                  for (int i=is; i<=ie; ++i) {
+                  for (int i=il; i<=iu; ++i) {
                     u_out(n,k,j,i) = wght[0]*u_out(n,k,j,i) + wght[1]*u_in1(n,k,j,i);
                   }
                 }
@@ -211,10 +229,10 @@ void MeshBlock::WeightedAve(AthenaArray<Real> &u_out, AthenaArray<Real> &u_in1,
             }
           } else { // do not dereference u_in1
             for (int n=0; n<=nu; ++n) {
-              for (int k=ks; k<=ke; ++k) {
-                for (int j=js; j<=je; ++j) {
+              for (int k=kl; k<=ku; ++k) {
+                for (int j=jl; j<=ju; ++j) {
 #pragma omp simd
-                  for (int i=is; i<=ie; ++i) {
+                  for (int i=il; i<=iu; ++i) {
                     u_out(n,k,j,i) *= wght[0];
                   }
                 }
@@ -10,6 +10,7 @@
 // C headers
 
 // C++ headers
+#include <algorithm>  // max, min
 #include <cstdio>
 #include <cstdlib>
 #include <iomanip>
@@ -38,168 +39,198 @@
 // "3" for 1-KE, 2-KE, 3-KE additional columns (come before tot-E)
 #define NHISTORY_VARS ((NHYDRO) + (SELF_GRAVITY_ENABLED > 0) + (NFIELD) + 3 + (NSCALARS))
 
+namespace {
+//! adds x to the running sum *s. With compensation, *c accumulates the rounding errors
+//! (Kahan summation) and the sum is s - c. Note -ffast-math may optimize it away.
+inline void AddToSum(Real x, bool compensated, Real *s, Real *c) {
+  if (compensated) {
+    Real y = x - *c;
+    Real t = *s + y;
+    *c = (t - *s) - y;
+    *s = t;
+  } else {
+    *s += x;
+  }
+  return;
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------
 //! \fn void HistoryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, bool flag)
 //! \brief Writes a history file
+//!
+//! The history variables of the MeshBlocks are computed in parallel, including the
+//! user-defined ones (whose functions must therefore be thread-safe), and the results of
+//! the MeshBlocks are combined in order afterwards, so that the output does not depend on
+//! the number of threads.
 
 void HistoryOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, bool flag) {
-  MeshBlock *pmb = pm->my_blocks(0);
   Real real_max = std::numeric_limits<Real>::max();
   Real real_lowest = std::numeric_limits<Real>::lowest();
-  AthenaArray<Real> vol(pmb->ncells1);
   const int nhistory_output = NHISTORY_VARS + pm->nuser_history_output_;
+  const bool compensated = output_params.compensated_sum;
   std::unique_ptr<Real[]> hst_data(new Real[nhistory_output]);
-  // initialize built-in variable sums to 0.0
-  for (int n=0; n<NHISTORY_VARS; ++n) hst_data[n] = 0.0;
-  // initialize user-defined history outputs depending on the requested operation
-  for (int n=0; n<pm->nuser_history_output_; n++) {
-    switch (pm->user_history_ops_[n]) {
-      case UserHistoryOperation::sum:
-        hst_data[NHISTORY_VARS+n] = 0.0;
-        break;
-      case UserHistoryOperation::max:
-        hst_data[NHISTORY_VARS+n] = real_lowest;
-        break;
-      case UserHistoryOperation::min:
-        hst_data[NHISTORY_VARS+n] = real_max;
-        break;
-    }
-  }
+  AthenaArray<Real> block_data(pm->nblocal, nhistory_output);
 
   // Loop over MeshBlocks
-  for (int b=0; b<pm->nblocal; ++b) {
-    pmb = pm->my_blocks(b);
-    Hydro *phyd = pmb->phydro;
-    Field *pfld = pmb->pfield;
-    PassiveScalars *psclr = pmb->pscalars;
-    Gravity *pgrav = pmb->pgrav;
-    OrbitalAdvection *porb = pmb->porb;
-
-    // Sum history variables over cells. Note ghost cells are never included in sums
-    if(porb->orbital_advection_defined
-       && !output_params.orbital_system_output) {
-      porb->ConvertOrbitalSystem(phyd->w, phyd->u, OrbitalTransform::cons);
-      for (int k=pmb->ks; k<=pmb->ke; ++k) {
-        for (int j=pmb->js; j<=pmb->je; ++j) {
-          pmb->pcoord->CellVolume(k, j, pmb->is, pmb->ie, vol);
-          for (int i=pmb->is; i<=pmb->ie; ++i) {
-            // NEW_OUTPUT_TYPES:
-
-            // Hydro conserved variables:
-            Real& u_d  = porb->u_orb(IDN,k,j,i);
-            Real& u_mx = porb->u_orb(IM1,k,j,i);
-            Real& u_my = porb->u_orb(IM2,k,j,i);
-            Real& u_mz = porb->u_orb(IM3,k,j,i);
-
-            hst_data[0] += vol(i)*u_d;
-            hst_data[1] += vol(i)*u_mx;
-            hst_data[2] += vol(i)*u_my;
-            hst_data[3] += vol(i)*u_mz;
-            // + partitioned KE by coordinate direction:
-            hst_data[4] += vol(i)*0.5*SQR(u_mx)/u_d;
-            hst_data[5] += vol(i)*0.5*SQR(u_my)/u_d;
-            hst_data[6] += vol(i)*0.5*SQR(u_mz)/u_d;
+#pragma omp parallel num_threads(pm->GetNumMeshThreads())
+  {
+    AthenaArray<Real> vol(pm->my_blocks(0)->ncells1);
+    Real comp[NHISTORY_VARS];
+#pragma omp for schedule(static)
+    for (int b=0; b<pm->nblocal; ++b) {
+      MeshBlock *pmb = pm->my_blocks(b);
+      Hydro *phyd = pmb->phydro;
+      Field *pfld = pmb->pfield;
+      PassiveScalars *psclr = pmb->pscalars;
+      Gravity *pgrav = pmb->pgrav;
+      OrbitalAdvection *porb = pmb->porb;
+      Real *blk_data = &block_data(b,0);
+      for (int n=0; n<NHISTORY_VARS; ++n) {
+        blk_data[n] = 0.0;
+        comp[n] = 0.0;
+      }
 
-            if (NON_BAROTROPIC_EOS) {
-              Real& u_e = porb->u_orb(IEN,k,j,i);
-              hst_data[7] += vol(i)*u_e;
-            }
-            // Graviatational potential energy:
-            if (SELF_GRAVITY_ENABLED) {
-              Real& phi = pgrav->phi(k,j,i);
-              hst_data[NHYDRO + 3] += vol(i)*0.5*u_d*phi;
-            }
-            // Cell-centered magnetic energy, partitioned by coordinate direction:
-            if (MAGNETIC_FIELDS_ENABLED) {
-              Real& bcc1 = pfld->bcc(IB1,k,j,i);
-              Real& bcc2 = pfld->bcc(IB2,k,j,i);
-              Real& bcc3 = pfld->bcc(IB3,k,j,i);
-              constexpr int prev_out = NHYDRO + 3 + (SELF_GRAVITY_ENABLED > 0);
-              hst_data[prev_out] += vol(i)*0.5*bcc1*bcc1;
-              hst_data[prev_out + 1] += vol(i)*0.5*bcc2*bcc2;
-              hst_data[prev_out + 2] += vol(i)*0.5*bcc3*bcc3;
-            }
-            // (conserved variable) Passive scalars:
-            for (int n=0; n<NSCALARS; n++) {
-              Real& s = psclr->s(n,k,j,i);
-              constexpr int prev_out = NHYDRO + 3 + (SELF_GRAVITY_ENABLED > 0) + NFIELD;
-              hst_data[prev_out + n] += vol(i)*s;
-            }
-          }
-        }
+      // Sum history variables over cells. Note ghost cells are never included in sums
+      bool orbital_system = porb->orbital_advection_defined
+                            && !output_params.orbital_system_output;
+      if (orbital_system) {
+        porb->ConvertOrbitalSystem(phyd->w, phyd->u, OrbitalTransform::cons);
       }
-    } else {
+      AthenaArray<Real> &u = orbital_system ? porb->u_orb : phyd->u;
       for (int k=pmb->ks; k<=pmb->ke; ++k) {
         for (int j=pmb->js; j<=pmb->je; ++j) {
           pmb->pcoord->CellVolume(k, j, pmb->is, pmb->ie, vol);
-          for (int i=pmb->is; i<=pmb->ie; ++i) {
-            // NEW_OUTPUT_TYPES:
+          // NEW_OUTPUT_TYPES:
 
-            // Hydro conserved variables:
-            Real& u_d  = phyd->u(IDN,k,j,i);
-            Real& u_mx = phyd->u(IM1,k,j,i);
-            Real& u_my = phyd->u(IM2,k,j,i);
-            Real& u_mz = phyd->u(IM3,k,j,i);
-
-            hst_data[0] += vol(i)*u_d;
-            hst_data[1] += vol(i)*u_mx;
-            hst_data[2] += vol(i)*u_my;
-            hst_data[3] += vol(i)*u_mz;
-            // + partitioned KE by coordinate direction:
-            hst_data[4] += vol(i)*0.5*SQR(u_mx)/u_d;
-            hst_data[5] += vol(i)*0.5*SQR(u_my)/u_d;
-            hst_data[6] += vol(i)*0.5*SQR(u_mz)/u_d;
+          // Hydro conserved variables + partitioned KE by coordinate direction:
+          Real mass = 0.0, mom1 = 0.0, mom2 = 0.0, mom3 = 0.0;
+          Real ke1 = 0.0, ke2 = 0.0, ke3 = 0.0;
+#pragma omp simd reduction(+:mass,mom1,mom2,mom3,ke1,ke2,ke3)
+          for (int i=pmb->is; i<=pmb->ie; ++i) {
+            const Real& u_d  = u(IDN,k,j,i);
+            const Real& u_mx = u(IM1,k,j,i);
+            const Real& u_my = u(IM2,k,j,i);
+            const Real& u_mz = u(IM3,k,j,i);
+            mass += vol(i)*u_d;
+            mom1 += vol(i)*u_mx;
+            mom2 += vol(i)*u_my;
+            mom3 += vol(i)*u_mz;
+            ke1 += vol(i)*0.5*SQR(u_mx)/u_d;
+            ke2 += vol(i)*0.5*SQR(u_my)/u_d;
+            ke3 += vol(i)*0.5*SQR(u_mz)/u_d;
+          }
+          AddToSum(mass, compensated, &blk_data[0], &comp[0]);
+          AddToSum(mom1, compensated, &blk_data[1], &comp[1]);
+          AddToSum(mom2, compensated, &blk_data[2], &comp[2]);
+          AddToSum(mom3, compensated, &blk_data[3], &comp[3]);
+          AddToSum(ke1, compensated, &blk_data[4], &comp[4]);
+          AddToSum(ke2, compensated, &blk_data[5], &comp[5]);
+          AddToSum(ke3, compensated, &blk_data[6], &comp[6]);
 
-            if (NON_BAROTROPIC_EOS) {
-              Real& u_e = phyd->u(IEN,k,j,i);
-              hst_data[7] += vol(i)*u_e;
+          if (NON_BAROTROPIC_EOS) {
+            Real etot = 0.0;
+#pragma omp simd reduction(+:etot)
+            for (int i=pmb->is; i<=pmb->ie; ++i) {
+              etot += vol(i)*u(IEN,k,j,i);
             }
-            // Graviatational potential energy:
-            if (SELF_GRAVITY_ENABLED) {
-              Real& phi = pgrav->phi(k,j,i);
-              hst_data[NHYDRO + 3] += vol(i)*0.5*u_d*phi;
+            AddToSum(etot, compensated, &blk_data[7], &comp[7]);
+          }
+          // Graviatational potential energy:
+          if (SELF_GRAVITY_ENABLED) {
+            Real egrav = 0.0;
+#pragma omp simd reduction(+:egrav)
+            for (int i=pmb->is; i<=pmb->ie; ++i) {
+              egrav += vol(i)*0.5*u(IDN,k,j,i)*pgrav->phi(k,j,i);
             }
-            // Cell-centered magnetic energy, partitioned by coordinate direction:
-            if (MAGNETIC_FIELDS_ENABLED) {
-              Real& bcc1 = pfld->bcc(IB1,k,j,i);
-              Real& bcc2 = pfld->bcc(IB2,k,j,i);
-              Real& bcc3 = pfld->bcc(IB3,k,j,i);
-              constexpr int prev_out = NHYDRO + 3 + (SELF_GRAVITY_ENABLED > 0);
-              hst_data[prev_out] += vol(i)*0.5*bcc1*bcc1;
-              hst_data[prev_out + 1] += vol(i)*0.5*bcc2*bcc2;
-              hst_data[prev_out + 2] += vol(i)*0.5*bcc3*bcc3;
+            constexpr int prev_out = NHYDRO + 3;
+            AddToSum(egrav, compensated, &blk_data[prev_out], &comp[prev_out]);
+          }
+          // Cell-centered magnetic energy, partitioned by coordinate direction:
+          if (MAGNETIC_FIELDS_ENABLED) {
+            Real me1 = 0.0, me2 = 0.0, me3 = 0.0;
+#pragma omp simd reduction(+:me1,me2,me3)
+            for (int i=pmb->is; i<=pmb->ie; ++i) {
+              const Real& bcc1 = pfld->bcc(IB1,k,j,i);
+              const Real& bcc2 = pfld->bcc(IB2,k,j,i);
+              const Real& bcc3 = pfld->bcc(IB3,k,j,i);
+              me1 += vol(i)*0.5*bcc1*bcc1;
+              me2 += vol(i)*0.5*bcc2*bcc2;
+              me3 += vol(i)*0.5*bcc3*bcc3;
             }
-            // (conserved variable) Passive scalars:
-            for (int n=0; n<NSCALARS; n++) {
-              Real& s = psclr->s(n,k,j,i);
-              constexpr int prev_out = NHYDRO + 3 + (SELF_GRAVITY_ENABLED > 0) + NFIELD;
-              hst_data[prev_out + n] += vol(i)*s;
+            constexpr int prev_out = NHYDRO + 3 + (SELF_GRAVITY_ENABLED > 0);
+            AddToSum(me1, compensated, &blk_data[prev_out], &comp[prev_out]);
+            AddToSum(me2, compensated, &blk_data[prev_out + 1], &comp[prev_out + 1]);
+            AddToSum(me3, compensated, &blk_data[prev_out + 2], &comp[prev_out + 2]);
+          }
+          // (conserved variable) Passive scalars:
+          for (int n=0; n<NSCALARS; n++) {
+            Real s_n = 0.0;
+#pragma omp simd reduction(+:s_n)
+            for (int i=pmb->is; i<=pmb->ie; ++i) {
+              s_n += vol(i)*psclr->s(n,k,j,i);
             }
+            constexpr int prev_out = NHYDRO + 3 + (SELF_GRAVITY_ENABLED > 0) + NFIELD;
+            AddToSum(s_n, compensated, &blk_data[prev_out + n], &comp[prev_out + n]);
           }
         }
       }
-    }
-    for (int n=0; n<pm->nuser_history_output_; n++) { // user-defined history outputs
-      if (pm->user_history_func_[n] != nullptr) {
-        Real usr_val = pm->user_history_func_[n](pmb, n);
-        switch (pm->user_history_ops_[n]) {
-          case UserHistoryOperation::sum:
-            // TODO(felker): this should automatically volume-weight the sum, like the
-            // built-in variables. But existing user-defined .hst fns are currently
-            // weighting their returned values.
-            hst_data[NHISTORY_VARS+n] += usr_val;
-            break;
-          case UserHistoryOperation::max:
-            hst_data[NHISTORY_VARS+n] = std::max(usr_val, hst_data[NHISTORY_VARS+n]);
-            break;
-          case UserHistoryOperation::min:
-            hst_data[NHISTORY_VARS+n] = std::min(usr_val, hst_data[NHISTORY_VARS+n]);
-            break;
+      for (int n=0; n<NHISTORY_VARS; ++n) {
+        blk_data[n] -= comp[n];
+      }
+      for (int n=0; n<pm->nuser_history_output_; n++) { // user-defined history outputs
+        if (pm->user_history_func_[n] != nullptr) {
+          blk_data[NHISTORY_VARS+n] = pm->user_history_func_[n](pmb, n);
         }
       }
     }
   }  // end loop over MeshBlocks
 
+  // combine built-in variable sums of MeshBlocks
+  for (int n=0; n<NHISTORY_VARS; ++n) {
+    Real comp = 0.0;
+    hst_data[n] = 0.0;
+    for (int b=0; b<pm->nblocal; ++b) {
+      AddToSum(block_data(b,n), compensated, &hst_data[n], &comp);
+    }
+    hst_data[n] -= comp;
+  }
+  // combine user-defined history outputs depending on the requested operation
+  for (int n=0; n<pm->nuser_history_output_; n++) {
+    Real &usr_data = hst_data[NHISTORY_VARS+n];
+    Real comp = 0.0;
+    switch (pm->user_history_ops_[n]) {
+      case UserHistoryOperation::sum:
+        usr_data = 0.0;
+        break;
+      case UserHistoryOperation::max:
+        usr_data = real_lowest;
+        break;
+      case UserHistoryOperation::min:
+        usr_data = real_max;
+        break;
+    }
+    if (pm->user_history_func_[n] == nullptr) continue;
+    for (int b=0; b<pm->nblocal; ++b) {
+      Real usr_val = block_data(b,NHISTORY_VARS+n);
+      switch (pm->user_history_ops_[n]) {
+        case UserHistoryOperation::sum:
+          // TODO(felker): this should automatically volume-weight the sum, like the
+          // built-in variables. But existing user-defined .hst fns are currently
+          // weighting their returned values.
+          AddToSum(usr_val, compensated, &usr_data, &comp);
+          break;
+        case UserHistoryOperation::max:
+          usr_data = std::max(usr_val, usr_data);
+          break;
+        case UserHistoryOperation::min:
+          usr_data = std::min(usr_val, usr_data);
+          break;
+      }
+    }
+    usr_data -= comp;
+  }
+
 #ifdef MPI_PARALLEL
   // sum built-in/predefined hst_data[] over all ranks
   if (Globals::my_rank == 0) {
@@ -157,6 +157,51 @@ std::size_t IOWrapper::Write_at_all(const void *buf, IOWrapperSizeT size,
 }
 
 
+//----------------------------------------------------------------------------------------
+//! \fn int IOWrapper::Iwrite_at_all(const void *buf, IOWrapperSizeT size,
+//!                                  IOWrapperSizeT cnt, IOWrapperSizeT offset)
+//! \brief wrapper for {MPI_File_iwrite_at_all} versus {std::fseek+std::fwrite}.
+//!
+//! Falls back to the noncollective MPI_File_iwrite_at before MPI-3.1. Without MPI, the
+//! data is written before returning.
+
+int IOWrapper::Iwrite_at_all(const void *buf, IOWrapperSizeT size,
+                             IOWrapperSizeT cnt, IOWrapperSizeT offset) {
+#ifdef MPI_PARALLEL
+  MPI_Request req;
+#if MPI_VERSION > 3 || (MPI_VERSION == 3 && MPI_SUBVERSION >= 1)
+  if (MPI_File_iwrite_at_all(fh_,offset,const_cast<void*>(buf),cnt*size,MPI_BYTE,&req)
+      !=MPI_SUCCESS)
+    return -1;
+#else
+  if (MPI_File_iwrite_at(fh_,offset,const_cast<void*>(buf),cnt*size,MPI_BYTE,&req)
+      !=MPI_SUCCESS)
+    return -1;
+#endif
+  req_.push_back(req);
+  return 0;
+#else
+  std::fseek(fh_, offset, SEEK_SET);
+  return (std::fwrite(buf,size,cnt,fh_) == cnt) ? 0 : -1;
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int IOWrapper::Wait()
+//! \brief wait for the completion of all pending Iwrite_at_all() calls
+
+int IOWrapper::Wait() {
+#ifdef MPI_PARALLEL
+  int ret = MPI_SUCCESS;
+  if (!req_.empty())
+    ret = MPI_Waitall(static_cast<int>(req_.size()), req_.data(), MPI_STATUSES_IGNORE);
+  req_.clear();
+  return ret;
+#else
+  return 0;
+#endif
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void IOWrapper::Close()
 //! \brief wrapper for {MPI_File_close} versus {std::fclose}
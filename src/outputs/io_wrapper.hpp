@@ -12,6 +12,7 @@
 
 // C++ headers
 #include <cstdio>
+#include <vector>
 
 // Athena++ headers
 #include "../athena.hpp"
@@ -46,6 +47,10 @@ class IOWrapper {
   std::size_t Write(const void *buf, IOWrapperSizeT size, IOWrapperSizeT count);
   std::size_t Write_at_all(const void *buf, IOWrapperSizeT size,
                            IOWrapperSizeT cnt, IOWrapperSizeT offset);
+  // nonblocking version: buf must not be modified or freed before Wait() returns
+  int Iwrite_at_all(const void *buf, IOWrapperSizeT size, IOWrapperSizeT cnt,
+                    IOWrapperSizeT offset);
+  int Wait();
   int Close();
   int Seek(IOWrapperSizeT offset);
   IOWrapperSizeT GetPosition();
@@ -54,6 +59,7 @@ class IOWrapper {
   IOWrapperFile fh_;
 #ifdef MPI_PARALLEL
   MPI_Comm comm_;
+  std::vector<MPI_Request> req_;  // pending Iwrite_at_all() calls
 #endif
 };
 #endif // OUTPUTS_IO_WRAPPER_HPP_
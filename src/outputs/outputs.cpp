@@ -236,6 +236,8 @@ Outputs::Outputs(Mesh *pm, ParameterInput *pin) {
         // Construct new OutputType according to file format
         // NEW_OUTPUT_TYPES: Add block to construct new types here
         if (op.file_type.compare("hst") == 0) {
+          op.compensated_sum = pin->GetOrAddBoolean(op.block_name, "compensated_sum",
+                                                    false);
           pnew_type = new HistoryOutput(op);
           num_hst_outputs++;
         } else if (op.file_type.compare("tab") == 0) {
@@ -243,6 +245,9 @@ Outputs::Outputs(Mesh *pm, ParameterInput *pin) {
         } else if (op.file_type.compare("vtk") == 0) {
           pnew_type = new VTKOutput(op);
         } else if (op.file_type.compare("rst") == 0) {
+          // snapshot the MeshBlocks and write the file in the background
+          op.async_write = pin->GetOrAddBoolean(op.block_name, "async", false);
+          op.compress = pin->GetOrAddBoolean(op.block_name, "compress", false);
           pnew_type = new RestartOutput(op);
           num_rst_outputs++;
         } else if (op.file_type.compare("ath5") == 0
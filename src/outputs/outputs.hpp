@@ -11,6 +11,7 @@
 // C headers
 
 // C++ headers
+#include <cstdint>  // std::uint64_t
 #include <cstdio>  // std::size_t
 #include <string>
 
@@ -45,6 +46,9 @@ struct OutputParameters {
   bool output_sumx1, output_sumx2, output_sumx3;
   bool include_ghost_zones, cartesian_vector;
   bool orbital_system_output;
+  bool async_write;  // rst only: write the file while the integration continues
+  bool compress;     // rst only: compressed format with per-MeshBlock checksums
+  bool compensated_sum;  // hst only: Kahan summation of the volume-weighted sums
   int islice, jslice, kslice;
   Real x1_slice, x2_slice, x3_slice;
   // TODO(felker): some of the parameters in this class are not initialized in constructor
@@ -52,6 +56,7 @@ struct OutputParameters {
                        output_slicex1(false),output_slicex2(false),output_slicex3(false),
                        output_sumx1(false), output_sumx2(false), output_sumx3(false),
                        include_ghost_zones(false), cartesian_vector(false),
+                       async_write(false), compress(false), compensated_sum(false),
                        islice(0), jslice(0), kslice(0) {}
 };
 
@@ -150,8 +155,19 @@ class VTKOutput : public OutputType {
 
 class RestartOutput : public OutputType {
  public:
-  explicit RestartOutput(OutputParameters oparams) : OutputType(oparams) {}
+  explicit RestartOutput(OutputParameters oparams) : OutputType(oparams),
+      pending_(false), idlist_(nullptr), data_(nullptr), index_(nullptr) {}
+  ~RestartOutput();
   void WriteOutputFile(Mesh *pm, ParameterInput *pin, bool flag) override;
+
+ private:
+  // with <output>/async = true, the file stays open and the staging buffers are kept
+  // until the write has completed, which is checked before the next dump
+  IOWrapper resfile_;
+  bool pending_;
+  char *idlist_, *data_;
+  std::uint64_t *index_;  // offset table of the compressed format
+  void FinishPendingWrite();
 };
 
 #ifdef HDF5OUTPUT
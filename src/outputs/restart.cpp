@@ -9,6 +9,7 @@
 // C headers
 
 // C++ headers
+#include <cstdint>   // std::uint64_t
 #include <cstdio>    // snprintf()
 #include <cstring>   // memcpy()
 #include <fstream>
@@ -27,17 +28,62 @@
 #include "../mesh/mesh.hpp"
 #include "../parameter_input.hpp"
 #include "../scalars/scalars.hpp"
+#include "../utils/compression.hpp"
 #include "outputs.hpp"
 
+// MPI header
+#ifdef MPI_PARALLEL
+#include <mpi.h>
+#endif
+
+
+//----------------------------------------------------------------------------------------
+//! RestartOutput destructor
+
+RestartOutput::~RestartOutput() {
+  FinishPendingWrite();
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void RestartOutput::FinishPendingWrite()
+//! \brief wait until the last asynchronous dump is on disk, then close the file and
+//!        release its staging buffers
+
+void RestartOutput::FinishPendingWrite() {
+  if (!pending_) return;
+  resfile_.Wait();
+  resfile_.Close();
+  delete [] idlist_;
+  delete [] data_;
+  delete [] index_;
+  idlist_ = nullptr;
+  data_ = nullptr;
+  index_ = nullptr;
+  pending_ = false;
+  return;
+}
 
 //----------------------------------------------------------------------------------------
 //! \fn void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, bool flag)
 //! \brief Cycles over all MeshBlocks and writes data to a single restart file.
+//!
+//! With <output>/async = true, the MeshBlocks are copied into the staging buffers and
+//! the file is written with nonblocking MPI-IO while the integration continues. Only
+//! the next dump waits for the write to complete. The file format is unchanged.
+//!
+//! With <output>/compress = true, the file is written in format version 2 (recorded as
+//! <restart>/format_version in the parameter header). The ID list is followed by an
+//! offset table with three 64-bit words per MeshBlock: the offset of its compressed data
+//! relative to the end of the table, the compressed size, and the checksum of the
+//! uncompressed data. Each MeshBlock is compressed independently with BlockCompression,
+//! so that every rank can still read and decompress only its own MeshBlocks.
 
 void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, bool force_write) {
-  IOWrapper resfile;
   IOWrapperSizeT listsize, headeroffset, datasize;
 
+  // the previous file and staging buffers are reused
+  FinishPendingWrite();
+
   // create single output filename:"file_basename"+"."+XXXXX+".rst",
   // where XXXXX = 5-digit file_number
   std::string fname;
@@ -62,7 +108,8 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, bool force_wr
     pin->SetInteger(output_params.block_name, "file_number", output_params.file_number);
     pin->SetReal(output_params.block_name, "next_time", output_params.next_time);
   }
-  resfile.Open(fname.c_str(), IOWrapper::FileMode::write);
+  pin->SetInteger("restart", "format_version", output_params.compress ? 2 : 1);
+  resfile_.Open(fname.c_str(), IOWrapper::FileMode::write);
 
   // prepare the input parameters
   std::stringstream ost;
@@ -89,16 +136,16 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, bool force_wr
   // write the header; this part is serial
   if (Globals::my_rank == 0) {
     // output the input parameters
-    resfile.Write(sbuf.c_str(),sizeof(char),sbuf.size());
+    resfile_.Write(sbuf.c_str(),sizeof(char),sbuf.size());
 
     // output Mesh information
-    resfile.Write(&(pm->nbtotal), sizeof(int), 1);
-    resfile.Write(&(pm->root_level), sizeof(int), 1);
-    resfile.Write(&(pm->mesh_size), sizeof(RegionSize), 1);
-    resfile.Write(&(pm->time), sizeof(Real), 1);
-    resfile.Write(&(pm->dt), sizeof(Real), 1);
-    resfile.Write(&(pm->ncycle), sizeof(int), 1);
-    resfile.Write(&(datasize), sizeof(IOWrapperSizeT), 1);
+    resfile_.Write(&(pm->nbtotal), sizeof(int), 1);
+    resfile_.Write(&(pm->root_level), sizeof(int), 1);
+    resfile_.Write(&(pm->mesh_size), sizeof(RegionSize), 1);
+    resfile_.Write(&(pm->time), sizeof(Real), 1);
+    resfile_.Write(&(pm->dt), sizeof(Real), 1);
+    resfile_.Write(&(pm->ncycle), sizeof(int), 1);
+    resfile_.Write(&(datasize), sizeof(IOWrapperSizeT), 1);
 
     // collect and write user Mesh data
     if (udsize != 0) {
@@ -114,36 +161,40 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, bool force_wr
                     pm->ruser_mesh_data[n].GetSizeInBytes());
         udoffset += pm->ruser_mesh_data[n].GetSizeInBytes();
       }
-      resfile.Write(ud, 1, udsize);
+      resfile_.Write(ud, 1, udsize);
       delete [] ud;
     }
   }
 
   // allocate memory for the ID list and the data
-  char *idlist = new char[listsize*mynb];
-  char *data = new char[mynb*datasize];
+  idlist_ = new char[listsize*mynb];
+  data_ = new char[mynb*datasize];
 
   // Loop over MeshBlocks and pack the meta data
   int os=0;
   for (int b=0; b<pm->nblocal; ++b) {
     MeshBlock *pmb = pm->my_blocks(b);
-    std::memcpy(&(idlist[os]), &(pmb->loc), sizeof(LogicalLocation));
+    std::memcpy(&(idlist_[os]), &(pmb->loc), sizeof(LogicalLocation));
     os += sizeof(LogicalLocation);
-    std::memcpy(&(idlist[os]), &(pmb->cost_), sizeof(double));
+    std::memcpy(&(idlist_[os]), &(pmb->cost_), sizeof(double));
     os += sizeof(double);
   }
 
   // write the ID list collectively
   IOWrapperSizeT myoffset = headeroffset + listsize*myns;
-  resfile.Write_at_all(idlist, listsize, mynb, myoffset);
-
-  // deallocate the idlist array
-  delete [] idlist;
+  if (output_params.async_write) {
+    resfile_.Iwrite_at_all(idlist_, listsize, mynb, myoffset);
+  } else {
+    resfile_.Write_at_all(idlist_, listsize, mynb, myoffset);
+    // deallocate the idlist array
+    delete [] idlist_;
+    idlist_ = nullptr;
+  }
 
   // Loop over MeshBlocks and pack the data
   for (int b=0; b<pm->nblocal; ++b) {
     MeshBlock *pmb = pm->my_blocks(b);
-    char *pdata = &(data[pmb->lid*datasize]);
+    char *pdata = &(data_[pmb->lid*datasize]);
 
     // NEW_OUTPUT_TYPES: add output of additional physics to restarts here also update
     // MeshBlock::GetBlockSizeInBytes accordingly and MeshBlock constructor for restarts.
@@ -200,8 +251,56 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin, bool force_wr
   }
 
   // now write restart data in parallel
-  myoffset = headeroffset + listsize*nbtotal + datasize*myns;
-  resfile.Write_at_all(data, datasize, mynb, myoffset);
-  resfile.Close();
-  delete [] data;
+  myoffset = headeroffset + listsize*nbtotal;
+  IOWrapperSizeT mysize = mynb*datasize;
+  if (output_params.compress) {
+    // compress each MeshBlock into a slot of the maximum size, then close the gaps
+    IOWrapperSizeT maxcsize = BlockCompression::MaxCompressedSize(datasize);
+    char *cdata = new char[mynb*maxcsize];
+    index_ = new std::uint64_t[3*mynb];
+#pragma omp parallel for num_threads(pm->GetNumMeshThreads())
+    for (int b=0; b<mynb; ++b) {
+      const char *praw = &(data_[b*datasize]);
+      index_[3*b+1] = BlockCompression::Compress(praw, datasize, sizeof(Real),
+                                                 &(cdata[b*maxcsize]));
+      index_[3*b+2] = BlockCompression::Checksum(praw, datasize);
+    }
+    std::uint64_t mystart = 0, mycsize = 0;
+    for (int b=0; b<mynb; ++b) {
+      std::memmove(&(cdata[mycsize]), &(cdata[b*maxcsize]), index_[3*b+1]);
+      index_[3*b] = mycsize;
+      mycsize += index_[3*b+1];
+    }
+#ifdef MPI_PARALLEL
+    MPI_Exscan(&mycsize, &mystart, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    if (Globals::my_rank == 0) mystart = 0;  // undefined on the first rank
+#endif
+    for (int b=0; b<mynb; ++b)
+      index_[3*b] += mystart;
+    delete [] data_;
+    data_ = cdata;
+    mysize = mycsize;
+
+    // write the offset table
+    IOWrapperSizeT tablesize = 3*sizeof(std::uint64_t);
+    if (output_params.async_write) {
+      resfile_.Iwrite_at_all(index_, tablesize, mynb, myoffset + tablesize*myns);
+    } else {
+      resfile_.Write_at_all(index_, tablesize, mynb, myoffset + tablesize*myns);
+      delete [] index_;
+      index_ = nullptr;
+    }
+    myoffset += tablesize*nbtotal + mystart;
+  } else {
+    myoffset += datasize*myns;
+  }
+  if (output_params.async_write) {
+    resfile_.Iwrite_at_all(data_, 1, mysize, myoffset);
+    pending_ = true;
+    return;
+  }
+  resfile_.Write_at_all(data_, 1, mysize, myoffset);
+  resfile_.Close();
+  delete [] data_;
+  data_ = nullptr;
 }
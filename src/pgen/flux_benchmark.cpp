@@ -0,0 +1,220 @@
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file flux_benchmark.cpp
+//! \brief Problem generator for timing Hydro::CalculateFluxes().
+//!
+//! Mesh::UserWorkAfterLoop() evaluates the fluxes of all MeshBlocks <problem>/ncycle
+//! times, first with whole pencils and then with the pencils split into tiles of
+//! 8, 16, 32, ... cells along x1 (<hydro>/flux_tile_size), up to the pencil length. It
+//! reports the time per MeshBlock update of each tile size and checks that all of them
+//! produce identical fluxes (and EMFs with MHD). Run with <time>/nlim = 0.
+
+// C headers
+
+// C++ headers
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// Athena++ headers
+#include "../athena.hpp"
+#include "../athena_arrays.hpp"
+#include "../coordinates/coordinates.hpp"
+#include "../eos/eos.hpp"
+#include "../field/field.hpp"
+#include "../globals.hpp"
+#include "../hydro/hydro.hpp"
+#include "../mesh/mesh.hpp"
+#include "../parameter_input.hpp"
+#include "../reconstruct/reconstruction.hpp"
+
+#ifdef OPENMP_PARALLEL
+#include <omp.h>
+#endif
+
+#ifdef MPI_PARALLEL
+#include <mpi.h>
+#endif
+
+namespace {
+double WallTime();
+Real FluxChecksum(Mesh *pm);
+} // namespace
+
+//========================================================================================
+//! \fn void MeshBlock::ProblemGenerator(ParameterInput *pin)
+//! \brief smooth, non-uniform data with extrema, so that the limiters are exercised
+//========================================================================================
+
+void MeshBlock::ProblemGenerator(ParameterInput *pin) {
+  Real gm1 = peos->GetGamma() - 1.0;
+  for (int k=ks; k<=ke; ++k) {
+    for (int j=js; j<=je; ++j) {
+      for (int i=is; i<=ie; ++i) {
+        Real x = pcoord->x1v(i), y = pcoord->x2v(j), z = pcoord->x3v(k);
+        Real den = 1.0 + 0.2*std::sin(2.0*PI*x)*std::cos(2.0*PI*y) + 0.1*std::sin(PI*z);
+        phydro->u(IDN,k,j,i) = den;
+        phydro->u(IM1,k,j,i) = den*0.5*std::cos(2.0*PI*y);
+        phydro->u(IM2,k,j,i) = den*0.5*std::sin(2.0*PI*z);
+        phydro->u(IM3,k,j,i) = den*0.5*std::cos(2.0*PI*x);
+        if (NON_BAROTROPIC_EOS)
+          phydro->u(IEN,k,j,i) = 1.0/gm1 + 0.125*den;
+      }
+    }
+  }
+  if (MAGNETIC_FIELDS_ENABLED) {
+    for (int k=ks; k<=ke; ++k) {
+      for (int j=js; j<=je; ++j) {
+        for (int i=is; i<=ie+1; ++i)
+          pfield->b.x1f(k,j,i) = 0.1 + 0.01*std::sin(2.0*PI*pcoord->x2v(j));
+      }
+    }
+    for (int k=ks; k<=ke; ++k) {
+      for (int j=js; j<=je+1; ++j) {
+        for (int i=is; i<=ie; ++i)
+          pfield->b.x2f(k,j,i) = 0.1 + 0.01*std::sin(2.0*PI*pcoord->x3v(k));
+      }
+    }
+    for (int k=ks; k<=ke+1; ++k) {
+      for (int j=js; j<=je; ++j) {
+        for (int i=is; i<=ie; ++i)
+          pfield->b.x3f(k,j,i) = 0.1 + 0.01*std::sin(2.0*PI*pcoord->x1v(i));
+      }
+    }
+  }
+  return;
+}
+
+//========================================================================================
+//! \fn void Mesh::UserWorkAfterLoop(ParameterInput *pin)
+//! \brief time Hydro::CalculateFluxes() with whole pencils and with tiles of pencils
+//========================================================================================
+
+void Mesh::UserWorkAfterLoop(ParameterInput *pin) {
+  int ncycle = pin->GetOrAddInteger("problem", "ncycle", 20);
+  int ncells1 = my_blocks(0)->ncells1;
+  std::vector<int> tile_size;
+  tile_size.push_back(0);
+  for (int t=8; t<ncells1; t*=2)
+    tile_size.push_back(t);
+  int nmode = static_cast<int>(tile_size.size());
+  std::vector<double> time_mode(nmode);
+  std::vector<Real> checksum(nmode);
+  int tile_input = my_blocks(0)->phydro->flux_tile_size;
+
+  for (int mode=0; mode<nmode; ++mode) {
+    for (int b=0; b<nblocal; ++b)
+      my_blocks(b)->phydro->flux_tile_size = tile_size[mode];
+#ifdef MPI_PARALLEL
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    double tstart = WallTime();
+    for (int n=0; n<ncycle; ++n) {
+#pragma omp parallel for num_threads(num_mesh_threads_) schedule(dynamic)
+      for (int b=0; b<nblocal; ++b) {
+        MeshBlock *pmb = my_blocks(b);
+        Hydro *ph = pmb->phydro;
+        Field *pf = pmb->pfield;
+        ph->CalculateFluxes(ph->w, pf->b, pf->bcc, pmb->precon->xorder);
+      }
+    }
+    time_mode[mode] = WallTime() - tstart;
+#ifdef MPI_PARALLEL
+    MPI_Allreduce(MPI_IN_PLACE, &time_mode[mode], 1, MPI_DOUBLE, MPI_MAX,
+                  MPI_COMM_WORLD);
+#endif
+    checksum[mode] = FluxChecksum(this);
+  }
+  for (int b=0; b<nblocal; ++b)
+    my_blocks(b)->phydro->flux_tile_size = tile_input;
+
+  int nmismatch = 0;
+  for (int mode=1; mode<nmode; ++mode)
+    if (checksum[mode] != checksum[0]) nmismatch++;
+#ifdef MPI_PARALLEL
+  MPI_Allreduce(MPI_IN_PLACE, &nmismatch, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  if (Globals::my_rank == 0) {
+    std::ios_base::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    MeshBlock *pmb = my_blocks(0);
+    std::cout << "=====================================================" << std::endl;
+    std::cout << "CalculateFluxes of " << nbtotal << " MeshBlocks of "
+              << pmb->block_size.nx1 << "x" << pmb->block_size.nx2 << "x"
+              << pmb->block_size.nx3 << " cells, xorder = " << pmb->precon->xorder
+              << ", on " << Globals::nranks << " rank(s) x " << num_mesh_threads_
+              << " thread(s), " << ncycle << " cycles" << std::endl;
+    for (int mode=0; mode<nmode; ++mode) {
+      if (mode == 0)
+        std::cout << "whole pencils: ";
+      else
+        std::cout << "tiles of " << std::setw(4) << tile_size[mode] << ": ";
+      std::cout << std::scientific << std::setprecision(6)
+                << 1.0e6*time_mode[mode]/ncycle/nbtotal*Globals::nranks
+                << " us per MeshBlock, speedup = " << std::fixed << std::setprecision(3)
+                << time_mode[0]/time_mode[mode] << std::endl;
+    }
+    std::cout << "fluxes identical: " << (nmismatch == 0 ? "yes" : "no") << std::endl;
+    std::cout << "=====================================================" << std::endl;
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+  }
+  if (nmismatch != 0) {
+    std::stringstream msg;
+    msg << "### FATAL ERROR in function [Mesh::UserWorkAfterLoop]" << std::endl
+        << "Tiled and whole-pencil flux calculations gave different fluxes." << std::endl;
+    ATHENA_ERROR(msg);
+  }
+  return;
+}
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \fn double WallTime()
+//! \brief wall-clock time in seconds
+
+double WallTime() {
+#ifdef MPI_PARALLEL
+  return MPI_Wtime();
+#elif defined(OPENMP_PARALLEL)
+  return omp_get_wtime();
+#else
+  return static_cast<double>(std::clock())/static_cast<double>(CLOCKS_PER_SEC);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real FluxChecksum(Mesh *pm)
+//! \brief weighted sum of the fluxes (and EMFs) of the local MeshBlocks; any difference
+//! in a flux changes the result
+
+Real FluxChecksum(Mesh *pm) {
+  Real sum = 0.0;
+  for (int b=0; b<pm->nblocal; ++b) {
+    MeshBlock *pmb = pm->my_blocks(b);
+    for (int dir=0; dir<3; ++dir) {
+      AthenaArray<Real> &flx = pmb->phydro->flux[dir];
+      for (int n=0; n<flx.GetSize(); ++n)
+        sum += static_cast<Real>(n%97 + dir + 1)*flx(n);
+    }
+    if (MAGNETIC_FIELDS_ENABLED) {
+      Field *pf = pmb->pfield;
+      AthenaArray<Real> *emf[6] = {&pf->e3_x1f, &pf->e2_x1f, &pf->e1_x2f,
+                                   &pf->e3_x2f, &pf->e1_x3f, &pf->e2_x3f};
+      for (int m=0; m<6; ++m) {
+        for (int n=0; n<emf[m]->GetSize(); ++n)
+          sum += static_cast<Real>(n%89 + m + 1)*(*emf[m])(n);
+      }
+    }
+  }
+  return sum;
+}
+} // namespace
@@ -0,0 +1,260 @@
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file ghost_exchange.cpp
+//! \brief Problem generator for timing the ghost-zone exchange between MeshBlocks.
+//!
+//! Mesh::UserWorkAfterLoop() performs <problem>/ncycle exchanges of the conserved
+//! variables (and of the face-centered magnetic field with MHD), first with the same-rank
+//! data copied through the send buffers and then with the data packed directly into the
+//! receive buffers of the target MeshBlocks (<mesh>/direct_boundary_copy). It reports the
+//! time per exchange of both modes and checks that they fill the ghost zones identically.
+//! Run with <time>/nlim = 0; use SMR to include the restriction/prolongation buffers.
+
+// C headers
+
+// C++ headers
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+// Athena++ headers
+#include "../athena.hpp"
+#include "../athena_arrays.hpp"
+#include "../bvals/bvals.hpp"
+#include "../coordinates/coordinates.hpp"
+#include "../eos/eos.hpp"
+#include "../field/field.hpp"
+#include "../globals.hpp"
+#include "../hydro/hydro.hpp"
+#include "../mesh/mesh.hpp"
+#include "../parameter_input.hpp"
+
+#ifdef OPENMP_PARALLEL
+#include <omp.h>
+#endif
+
+#ifdef MPI_PARALLEL
+#include <mpi.h>
+#endif
+
+namespace {
+double WallTime();
+void ZeroGhostZones(AthenaArray<Real> &var, int is, int ie, int js, int je, int ks,
+                    int ke);
+Real GhostZoneChecksum(Mesh *pm);
+} // namespace
+
+//========================================================================================
+//! \fn void MeshBlock::ProblemGenerator(ParameterInput *pin)
+//! \brief smooth, non-uniform data so that every ghost zone receives a distinct value
+//========================================================================================
+
+void MeshBlock::ProblemGenerator(ParameterInput *pin) {
+  Real gm1 = peos->GetGamma() - 1.0;
+  for (int k=ks; k<=ke; ++k) {
+    for (int j=js; j<=je; ++j) {
+      for (int i=is; i<=ie; ++i) {
+        Real x = pcoord->x1v(i), y = pcoord->x2v(j), z = pcoord->x3v(k);
+        Real den = 1.0 + 0.2*std::sin(2.0*PI*x)*std::cos(2.0*PI*y) + 0.1*std::sin(PI*z);
+        phydro->u(IDN,k,j,i) = den;
+        phydro->u(IM1,k,j,i) = den*std::cos(2.0*PI*y);
+        phydro->u(IM2,k,j,i) = den*std::sin(2.0*PI*z);
+        phydro->u(IM3,k,j,i) = den*std::cos(2.0*PI*x);
+        if (NON_BAROTROPIC_EOS)
+          phydro->u(IEN,k,j,i) = 1.0/gm1 + 0.5*den;
+      }
+    }
+  }
+  if (MAGNETIC_FIELDS_ENABLED) {
+    for (int k=ks; k<=ke; ++k) {
+      for (int j=js; j<=je; ++j) {
+        for (int i=is; i<=ie+1; ++i)
+          pfield->b.x1f(k,j,i) = 0.1 + 0.01*std::sin(2.0*PI*pcoord->x2v(j));
+      }
+    }
+    for (int k=ks; k<=ke; ++k) {
+      for (int j=js; j<=je+1; ++j) {
+        for (int i=is; i<=ie; ++i)
+          pfield->b.x2f(k,j,i) = 0.1 + 0.01*std::sin(2.0*PI*pcoord->x3v(k));
+      }
+    }
+    for (int k=ks; k<=ke+1; ++k) {
+      for (int j=js; j<=je; ++j) {
+        for (int i=is; i<=ie; ++i)
+          pfield->b.x3f(k,j,i) = 0.1 + 0.01*std::sin(2.0*PI*pcoord->x1v(i));
+      }
+    }
+  }
+  return;
+}
+
+//========================================================================================
+//! \fn void Mesh::UserWorkAfterLoop(ParameterInput *pin)
+//! \brief time the ghost-zone exchange with and without the direct same-rank copies
+//========================================================================================
+
+void Mesh::UserWorkAfterLoop(ParameterInput *pin) {
+  int ncycle = pin->GetOrAddInteger("problem", "ncycle", 100);
+  bool direct_input = direct_boundary_copy;
+  double time_mode[2];
+  Real checksum[2];
+
+  for (int mode=0; mode<2; ++mode) {
+    direct_boundary_copy = (mode == 1);
+    // erase the ghost zones, so that the checksum only sees what this mode filled
+    for (int b=0; b<nblocal; ++b) {
+      MeshBlock *pmb = my_blocks(b);
+      pmb->phydro->hbvar.SwapHydroQuantity(pmb->phydro->u, HydroBoundaryQuantity::cons);
+      ZeroGhostZones(pmb->phydro->u, pmb->is, pmb->ie, pmb->js, pmb->je,
+                     pmb->ks, pmb->ke);
+      if (MAGNETIC_FIELDS_ENABLED) {
+        FaceField &bf = pmb->pfield->b;
+        ZeroGhostZones(bf.x1f, pmb->is, pmb->ie+1, pmb->js, pmb->je, pmb->ks, pmb->ke);
+        ZeroGhostZones(bf.x2f, pmb->is, pmb->ie, pmb->js, pmb->je+f2, pmb->ks, pmb->ke);
+        ZeroGhostZones(bf.x3f, pmb->is, pmb->ie, pmb->js, pmb->je, pmb->ks, pmb->ke+f3);
+      }
+    }
+#ifdef MPI_PARALLEL
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    double tstart = WallTime();
+    for (int n=0; n<ncycle; ++n) {
+#pragma omp parallel num_threads(num_mesh_threads_)
+      {
+        MeshBlock *pmb;
+        BoundaryValues *pbval;
+#pragma omp for private(pmb,pbval)
+        for (int b=0; b<nblocal; ++b) {
+          pmb = my_blocks(b); pbval = pmb->pbval;
+          pbval->StartReceivingSubset(BoundaryCommSubset::mesh_init,
+                                      pbval->bvars_main_int);
+        }
+#pragma omp for private(pmb,pbval)
+        for (int b=0; b<nblocal; ++b) {
+          pmb = my_blocks(b); pbval = pmb->pbval;
+          pmb->phydro->hbvar.SendBoundaryBuffers();
+          if (MAGNETIC_FIELDS_ENABLED)
+            pmb->pfield->fbvar.SendBoundaryBuffers();
+        }
+#pragma omp for private(pmb,pbval)
+        for (int b=0; b<nblocal; ++b) {
+          pmb = my_blocks(b); pbval = pmb->pbval;
+          pmb->phydro->hbvar.ReceiveAndSetBoundariesWithWait();
+          if (MAGNETIC_FIELDS_ENABLED)
+            pmb->pfield->fbvar.ReceiveAndSetBoundariesWithWait();
+          pbval->ClearBoundarySubset(BoundaryCommSubset::mesh_init,
+                                     pbval->bvars_main_int);
+        }
+      }
+    }
+    time_mode[mode] = WallTime() - tstart;
+#ifdef MPI_PARALLEL
+    MPI_Allreduce(MPI_IN_PLACE, &time_mode[mode], 1, MPI_DOUBLE, MPI_MAX,
+                  MPI_COMM_WORLD);
+#endif
+    checksum[mode] = GhostZoneChecksum(this);
+  }
+  direct_boundary_copy = direct_input;
+
+  int nmismatch = (checksum[0] == checksum[1]) ? 0 : 1;
+#ifdef MPI_PARALLEL
+  MPI_Allreduce(MPI_IN_PLACE, &nmismatch, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  if (Globals::my_rank == 0) {
+    std::ios_base::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    std::cout << "=====================================================" << std::endl;
+    std::cout << "Ghost-zone exchange of " << nbtotal << " MeshBlocks on "
+              << Globals::nranks << " rank(s) x " << num_mesh_threads_
+              << " thread(s), " << ncycle << " cycles" << std::endl;
+    std::cout << std::scientific << std::setprecision(6);
+    std::cout << "buffered copy: " << 1.0e6*time_mode[0]/ncycle
+              << " us per exchange" << std::endl;
+    std::cout << "direct copy:   " << 1.0e6*time_mode[1]/ncycle
+              << " us per exchange" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "speedup:       " << time_mode[0]/time_mode[1] << std::endl;
+    std::cout << "ghost zones identical: " << (nmismatch == 0 ? "yes" : "no")
+              << std::endl;
+    std::cout << "=====================================================" << std::endl;
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+  }
+  if (nmismatch != 0) {
+    std::stringstream msg;
+    msg << "### FATAL ERROR in function [Mesh::UserWorkAfterLoop]" << std::endl
+        << "Direct and buffered same-rank copies filled the ghost zones differently."
+        << std::endl;
+    ATHENA_ERROR(msg);
+  }
+  return;
+}
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \fn double WallTime()
+//! \brief wall-clock time in seconds
+
+double WallTime() {
+#ifdef MPI_PARALLEL
+  return MPI_Wtime();
+#elif defined(OPENMP_PARALLEL)
+  return omp_get_wtime();
+#else
+  return static_cast<double>(std::clock())/static_cast<double>(CLOCKS_PER_SEC);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ZeroGhostZones(AthenaArray<Real> &var, int is, int ie, int js, int je,
+//!                         int ks, int ke)
+//! \brief set var to zero outside of the active index range [ks:ke,js:je,is:ie]
+
+void ZeroGhostZones(AthenaArray<Real> &var, int is, int ie, int js, int je, int ks,
+                    int ke) {
+  int nvar = (var.GetDim4() > 0) ? var.GetDim4() : 1;
+  for (int n=0; n<nvar; ++n) {
+    for (int k=0; k<var.GetDim3(); ++k) {
+      for (int j=0; j<var.GetDim2(); ++j) {
+        for (int i=0; i<var.GetDim1(); ++i) {
+          if (k < ks || k > ke || j < js || j > je || i < is || i > ie)
+            var(n,k,j,i) = 0.0;
+        }
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Real GhostZoneChecksum(Mesh *pm)
+//! \brief weighted sum of the conserved variables (and field) of the local MeshBlocks,
+//! including the ghost zones; any difference in a ghost zone changes the result
+
+Real GhostZoneChecksum(Mesh *pm) {
+  Real sum = 0.0;
+  for (int b=0; b<pm->nblocal; ++b) {
+    MeshBlock *pmb = pm->my_blocks(b);
+    AthenaArray<Real> &u = pmb->phydro->u;
+    for (int n=0; n<u.GetSize(); ++n)
+      sum += static_cast<Real>(n%97 + 1)*u(n);
+    if (MAGNETIC_FIELDS_ENABLED) {
+      FaceField &bf = pmb->pfield->b;
+      for (int n=0; n<bf.x1f.GetSize(); ++n)
+        sum += static_cast<Real>(n%89 + 1)*bf.x1f(n);
+      for (int n=0; n<bf.x2f.GetSize(); ++n)
+        sum += static_cast<Real>(n%83 + 1)*bf.x2f(n);
+      for (int n=0; n<bf.x3f.GetSize(); ++n)
+        sum += static_cast<Real>(n%79 + 1)*bf.x3f(n);
+    }
+  }
+  return sum;
+}
+} // namespace
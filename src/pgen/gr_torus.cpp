@@ -44,6 +44,7 @@ void OutflowBoundary(MeshBlock *pmb, Coordinates *pcoord, AthenaArray<Real> &pri
     int ngh);
 Real ThetaGrid(Real x, RegionSize rs);
 Real HistorySum(MeshBlock *pmb, int iout);
+Real InversionHistory(MeshBlock *pmb, int iout);
 
 // File declarations
 namespace {
@@ -201,8 +202,12 @@ void Mesh::InitUserMeshData(ParameterInput *pin) {
   if (x2rat < 0.0) {
     EnrollUserMeshGenerator(X2DIR, ThetaGrid);
   }
+  num_flux_radii = std::max(num_flux_radii, 0);
+  int num_inversion_outputs = MAGNETIC_FIELDS_ENABLED ? 3 : 0;
+  if (num_flux_radii + num_inversion_outputs > 0) {
+    AllocateUserHistoryOutput(num_flux_radii * 4 + num_inversion_outputs);
+  }
   if (num_flux_radii > 0) {
-    AllocateUserHistoryOutput(num_flux_radii * 4);
     for (int n = 0; n < num_flux_radii; ++n) {
       std::stringstream mdot_name, edot_name, jdot_name, phi_name;
       mdot_name << "mdot_" << n + 1;
@@ -215,6 +220,11 @@ void Mesh::InitUserMeshData(ParameterInput *pin) {
       EnrollUserHistoryOutput(n * 4 + 3, HistorySum, phi_name.str().c_str());
     }
   }
+  if (num_inversion_outputs > 0) {
+    EnrollUserHistoryOutput(num_flux_radii * 4, InversionHistory, "c2p-iter");
+    EnrollUserHistoryOutput(num_flux_radii * 4 + 1, InversionHistory, "c2p-fallback");
+    EnrollUserHistoryOutput(num_flux_radii * 4 + 2, InversionHistory, "c2p-fail");
+  }
 
   // Calculate global constants describing torus and tilt
   if (r_peak >= 0.0) {
@@ -881,6 +891,26 @@ Real HistorySum(MeshBlock *pmb, int iout) {
   return pmb->ruser_meshblock_data[4](iout/4,iout%4);
 }
 
+//----------------------------------------------------------------------------------------
+// Variable inversion statistics extraction
+// Inputs:
+//   pmb: pointer to MeshBlock
+//   iout: index of history output
+// Outputs:
+//   returned value: block count of iterations, fallbacks, or failures of inversion since
+//       start of run
+
+Real InversionHistory(MeshBlock *pmb, int iout) {
+  switch (iout - num_flux_radii * 4) {
+    case 0:
+      return static_cast<Real>(pmb->peos->c2p_iterations);
+    case 1:
+      return static_cast<Real>(pmb->peos->c2p_fallbacks);
+    default:
+      return static_cast<Real>(pmb->peos->c2p_failures);
+  }
+}
+
 //----------------------------------------------------------------------------------------
 // Function for returning corresponding spherical Kerr-Schild coordinates of point
 // Inputs:
@@ -217,35 +217,35 @@ Reconstruction::Reconstruction(MeshBlock *pmb, ParameterInput *pin) :
   // TODO(c-white): use modified version of curvilinear PPM reconstruction weights and
   // limiter formulations for Schwarzschild, Kerr metrics instead of Cartesian-like wghts
 
-  // Allocate memory for scratch arrays used in PLM and PPM
+  // Allocate memory for scratch arrays used in PLM and PPM, with padded and aligned rows
   int nc1 = pmb->ncells1;
-  scr01_i_.NewAthenaArray(nc1);
-  scr02_i_.NewAthenaArray(nc1);
+  scr01_i_.NewPaddedAthenaArray(nc1);
+  scr02_i_.NewPaddedAthenaArray(nc1);
 
-  scr1_ni_.NewAthenaArray(std::max(NWAVE, NSCALARS), nc1);
-  scr2_ni_.NewAthenaArray(std::max(NWAVE, NSCALARS), nc1);
-  scr3_ni_.NewAthenaArray(std::max(NWAVE, NSCALARS), nc1);
-  scr4_ni_.NewAthenaArray(std::max(NWAVE, NSCALARS), nc1);
+  scr1_ni_.NewPaddedAthenaArray(std::max(NWAVE, NSCALARS), nc1);
+  scr2_ni_.NewPaddedAthenaArray(std::max(NWAVE, NSCALARS), nc1);
+  scr3_ni_.NewPaddedAthenaArray(std::max(NWAVE, NSCALARS), nc1);
+  scr4_ni_.NewPaddedAthenaArray(std::max(NWAVE, NSCALARS), nc1);
 
   if ((xorder == 3) || (xorder == 4)) {
     Coordinates *pco = pmb->pcoord;
-    scr03_i_.NewAthenaArray(nc1);
-    scr04_i_.NewAthenaArray(nc1);
-    scr05_i_.NewAthenaArray(nc1);
-    scr06_i_.NewAthenaArray(nc1);
-    scr07_i_.NewAthenaArray(nc1);
-    scr08_i_.NewAthenaArray(nc1);
-    scr09_i_.NewAthenaArray(nc1);
-    scr10_i_.NewAthenaArray(nc1);
-    scr11_i_.NewAthenaArray(nc1);
-    scr12_i_.NewAthenaArray(nc1);
-    scr13_i_.NewAthenaArray(nc1);
-    scr14_i_.NewAthenaArray(nc1);
-
-    scr5_ni_.NewAthenaArray(std::max(NWAVE, NSCALARS), nc1);
-    scr6_ni_.NewAthenaArray(std::max(NWAVE, NSCALARS), nc1);
-    scr7_ni_.NewAthenaArray(std::max(NWAVE, NSCALARS), nc1);
-    scr8_ni_.NewAthenaArray(std::max(NWAVE, NSCALARS), nc1);
+    scr03_i_.NewPaddedAthenaArray(nc1);
+    scr04_i_.NewPaddedAthenaArray(nc1);
+    scr05_i_.NewPaddedAthenaArray(nc1);
+    scr06_i_.NewPaddedAthenaArray(nc1);
+    scr07_i_.NewPaddedAthenaArray(nc1);
+    scr08_i_.NewPaddedAthenaArray(nc1);
+    scr09_i_.NewPaddedAthenaArray(nc1);
+    scr10_i_.NewPaddedAthenaArray(nc1);
+    scr11_i_.NewPaddedAthenaArray(nc1);
+    scr12_i_.NewPaddedAthenaArray(nc1);
+    scr13_i_.NewPaddedAthenaArray(nc1);
+    scr14_i_.NewPaddedAthenaArray(nc1);
+
+    scr5_ni_.NewPaddedAthenaArray(std::max(NWAVE, NSCALARS), nc1);
+    scr6_ni_.NewPaddedAthenaArray(std::max(NWAVE, NSCALARS), nc1);
+    scr7_ni_.NewPaddedAthenaArray(std::max(NWAVE, NSCALARS), nc1);
+    scr8_ni_.NewPaddedAthenaArray(std::max(NWAVE, NSCALARS), nc1);
 
     // Precompute PPM coefficients in x1-direction ---------------------------------------
     c1i.NewAthenaArray(nc1);
@@ -41,60 +41,109 @@
 
 void PassiveScalars::AddFluxDivergence(const Real wght, AthenaArray<Real> &s_out) {
   MeshBlock *pmb = pmy_block;
+  for (int k=pmb->ks; k<=pmb->ke; ++k) {
+    for (int j=pmb->js; j<=pmb->je; ++j) {
+      AddPencilFluxDivergence(wght, k, j, s_out);
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void PassiveScalars::WeightedAveFluxDivergence(const Real wght_s1[5],
+//!                                                      const Real wght_s[5],
+//!                                                      const Real wght)
+//! \brief s1 = WeightedAve(s1, s, ...), s = WeightedAve(s, s1, s2, ...) and
+//! s -= wght*div(s_flux) in one pass over the MeshBlock, see
+//! Hydro::WeightedAveFluxDivergence()
+
+void PassiveScalars::WeightedAveFluxDivergence(const Real wght_s1[5],
+                                               const Real wght_s[5], const Real wght) {
+  MeshBlock *pmb = pmy_block;
+  const bool swap = (wght_s[0] == 0.0 && wght_s[1] == 1.0 && wght_s[2] == 0.0);
+  AthenaArray<Real> &s_out = swap ? s1 : s;
+
+  for (int k=pmb->ks; k<=pmb->ke; ++k) {
+    for (int j=pmb->js; j<=pmb->je; ++j) {
+      pmb->WeightedAve(s1, s, s2, s0, s_fl_div, wght_s1, k, k, j, j, pmb->is, pmb->ie);
+      if (!swap)
+        pmb->WeightedAve(s, s1, s2, s0, s_fl_div, wght_s, k, k, j, j, pmb->is, pmb->ie);
+      AddPencilFluxDivergence(wght, k, j, s_out);
+    }
+  }
+  if (swap) s.SwapAthenaArray(s1);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  void PassiveScalars::AddPencilFluxDivergence(const Real wght, const int k,
+//!                                                    const int j,
+//!                                                    AthenaArray<Real> &s_out)
+//! \brief Adds the flux divergence of the pencil (k,j) to s_out
+
+void PassiveScalars::AddPencilFluxDivergence(const Real wght, const int k, const int j,
+                                             AthenaArray<Real> &s_out) {
+  MeshBlock *pmb = pmy_block;
   AthenaArray<Real> &x1flux = s_flux[X1DIR];
   AthenaArray<Real> &x2flux = s_flux[X2DIR];
   AthenaArray<Real> &x3flux = s_flux[X3DIR];
-  int is = pmb->is; int js = pmb->js; int ks = pmb->ks;
-  int ie = pmb->ie; int je = pmb->je; int ke = pmb->ke;
+  int is = pmb->is; int ie = pmb->ie;
   AthenaArray<Real> &x1area = x1face_area_, &x2area = x2face_area_,
                  &x2area_p1 = x2face_area_p1_, &x3area = x3face_area_,
                  &x3area_p1 = x3face_area_p1_, &vol = cell_volume_, &dflx = dflx_;
 
-  for (int k=ks; k<=ke; ++k) {
-    for (int j=js; j<=je; ++j) {
-      // calculate x1-flux divergence
-      pmb->pcoord->Face1Area(k, j, is, ie+1, x1area);
-      for (int n=0; n<NSCALARS; ++n) {
+  if (pmb->pcoord->GeometryCached()) {
+    pmb->pcoord->CachedFluxDivergence(s_flux, 0, NSCALARS-1, k, j, is, ie, dflx);
+    for (int n=0; n<NSCALARS; ++n) {
 #pragma omp simd
-        for (int i=is; i<=ie; ++i) {
-          dflx(n,i) = (x1area(i+1)*x1flux(n,k,j,i+1) - x1area(i)*x1flux(n,k,j,i));
-        }
+      for (int i=is; i<=ie; ++i) {
+        s_out(n,k,j,i) -= wght*dflx(n,i);
       }
+    }
+    return;
+  }
 
-      // calculate x2-flux divergence
-      if (pmb->block_size.nx2 > 1) {
-        pmb->pcoord->Face2Area(k, j  , is, ie, x2area   );
-        pmb->pcoord->Face2Area(k, j+1, is, ie, x2area_p1);
-        for (int n=0; n<NSCALARS; ++n) {
+  // calculate x1-flux divergence
+  pmb->pcoord->Face1Area(k, j, is, ie+1, x1area);
+  for (int n=0; n<NSCALARS; ++n) {
 #pragma omp simd
-          for (int i=is; i<=ie; ++i) {
-            dflx(n,i) += (x2area_p1(i)*x2flux(n,k,j+1,i) - x2area(i)*x2flux(n,k,j,i));
-          }
-        }
-      }
+    for (int i=is; i<=ie; ++i) {
+      dflx(n,i) = (x1area(i+1)*x1flux(n,k,j,i+1) - x1area(i)*x1flux(n,k,j,i));
+    }
+  }
 
-      // calculate x3-flux divergence
-      if (pmb->block_size.nx3 > 1) {
-        pmb->pcoord->Face3Area(k  , j, is, ie, x3area   );
-        pmb->pcoord->Face3Area(k+1, j, is, ie, x3area_p1);
-        for (int n=0; n<NSCALARS; ++n) {
+  // calculate x2-flux divergence
+  if (pmb->block_size.nx2 > 1) {
+    pmb->pcoord->Face2Area(k, j  , is, ie, x2area   );
+    pmb->pcoord->Face2Area(k, j+1, is, ie, x2area_p1);
+    for (int n=0; n<NSCALARS; ++n) {
 #pragma omp simd
-          for (int i=is; i<=ie; ++i) {
-            dflx(n,i) += (x3area_p1(i)*x3flux(n,k+1,j,i) - x3area(i)*x3flux(n,k,j,i));
-          }
-        }
+      for (int i=is; i<=ie; ++i) {
+        dflx(n,i) += (x2area_p1(i)*x2flux(n,k,j+1,i) - x2area(i)*x2flux(n,k,j,i));
       }
+    }
+  }
 
-      // update conserved variables
-      pmb->pcoord->CellVolume(k, j, is, ie, vol);
-      for (int n=0; n<NSCALARS; ++n) {
+  // calculate x3-flux divergence
+  if (pmb->block_size.nx3 > 1) {
+    pmb->pcoord->Face3Area(k  , j, is, ie, x3area   );
+    pmb->pcoord->Face3Area(k+1, j, is, ie, x3area_p1);
+    for (int n=0; n<NSCALARS; ++n) {
 #pragma omp simd
-        for (int i=is; i<=ie; ++i) {
-          s_out(n,k,j,i) -= wght*dflx(n,i)/vol(i);
-        }
+      for (int i=is; i<=ie; ++i) {
+        dflx(n,i) += (x3area_p1(i)*x3flux(n,k+1,j,i) - x3area(i)*x3flux(n,k,j,i));
       }
     }
   }
+
+  // update conserved variables
+  pmb->pcoord->CellVolume(k, j, is, ie, vol);
+  for (int n=0; n<NSCALARS; ++n) {
+#pragma omp simd
+    for (int i=is; i<=ie; ++i) {
+      s_out(n,k,j,i) -= wght*dflx(n,i)/vol(i);
+    }
+  }
   return;
 }
 
@@ -118,6 +167,24 @@ void PassiveScalars::AddFluxDivergence_STS(const Real wght, int stage,
                  &x2area_p1 = x2face_area_p1_, &x3area = x3face_area_,
                  &x3area_p1 = x3face_area_p1_, &vol = cell_volume_, &dflx = dflx_;
 
+  if (pmb->pcoord->GeometryCached()) {
+    for (int k=ks; k<=ke; ++k) {
+      for (int j=js; j<=je; ++j) {
+        pmb->pcoord->CachedFluxDivergence(s_flux, 0, NSCALARS-1, k, j, is, ie, dflx);
+        for (int n=0; n<NSCALARS; ++n) {
+#pragma omp simd
+          for (int i=is; i<=ie; ++i) {
+            s_out(n,k,j,i) -= wght*dflx(n,i);
+            if (stage == 1 && pmb->pmy_mesh->sts_integrator == "rkl2") {
+              s_fl_div_out(n,k,j,i) = -0.5*pmb->pmy_mesh->dt*dflx(n,i);
+            }
+          }
+        }
+      }
+    }
+    return;
+  }
+
   for (int k=ks; k<=ke; ++k) {
     for (int j=js; j<=je; ++j) {
       // calculate x1-flux divergence
@@ -39,6 +39,28 @@
 //!   approximations (flux_fc in calculate_fluxes.cpp is currently not saved persistently
 //!   in Hydro class but each flux dir is temp. stored in 4D scratch array scr1_nkji_)
 void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
+  switch (order) {
+    case 1:
+      CalculateFluxesPipeline<1>(r);
+      break;
+    case 2:
+      CalculateFluxesPipeline<2>(r);
+      break;
+    case 3:
+      CalculateFluxesPipeline<3>(r);
+      break;
+    default:
+      CalculateFluxesPipeline<4>(r);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn  template <int ORDER> void PassiveScalars::CalculateFluxesPipeline
+//! \brief CalculateFluxes() specialized for the reconstruction order
+
+template <int ORDER>
+void PassiveScalars::CalculateFluxesPipeline(AthenaArray<Real> &r) {
   MeshBlock *pmb = pmy_block;
 
 
@@ -74,9 +96,9 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
   for (int k=kl; k<=ku; ++k) {
     for (int j=jl; j<=ju; ++j) {
       // reconstruct L/R states
-      if (order == 1) {
+      if (ORDER == 1) {
         pmb->precon->DonorCellX1(k, j, is-1, ie+1, r, rl_, rr_);
-      } else if (order == 2) {
+      } else if (ORDER == 2) {
         pmb->precon->PiecewiseLinearX1(k, j, is-1, ie+1, r, rl_, rr_);
       } else {
         pmb->precon->PiecewiseParabolicX1(k, j, is-1, ie+1, r, rl_, rr_);
@@ -91,7 +113,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
 
       ComputeUpwindFlux(k, j, is, ie+1, rl_, rr_, mass_flux, x1flux);
 
-      if (order == 4) {
+      if (ORDER == 4) {
         for (int n=0; n<NSCALARS; n++) {
           for (int i=is; i<=ie+1; i++) {
             rl3d_(n,k,j,i) = rl_(n,i);
@@ -102,7 +124,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
     }
   }
 
-  if (order == 4) {
+  if (ORDER == 4) {
     // TODO(felker): assuming uniform mesh with dx1f=dx2f=dx3f, so this should factor out
     // TODO(felker): also, this may need to be dx1v, since Laplacian is cell-centered
     Real h = pmb->pcoord->dx1f(is);  // pco->dx1f(i); inside loop
@@ -138,7 +160,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
         }
       }
     }
-  } // end if (order == 4)
+  } // end if (ORDER == 4)
   //------------------------------------------------------------------------------
   // end x1 fourth-order hydro
 
@@ -162,9 +184,9 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
 
     for (int k=kl; k<=ku; ++k) {
       // reconstruct the first row
-      if (order == 1) {
+      if (ORDER == 1) {
         pmb->precon->DonorCellX2(k, js-1, il, iu, r, rl_, rr_);
-      } else if (order == 2) {
+      } else if (ORDER == 2) {
         pmb->precon->PiecewiseLinearX2(k, js-1, il, iu, r, rl_, rr_);
       } else {
         pmb->precon->PiecewiseParabolicX2(k, js-1, il, iu, r, rl_, rr_);
@@ -178,9 +200,9 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
       }
       for (int j=js; j<=je+1; ++j) {
         // reconstruct L/R states at j
-        if (order == 1) {
+        if (ORDER == 1) {
           pmb->precon->DonorCellX2(k, j, il, iu, r, rlb_, rr_);
-        } else if (order == 2) {
+        } else if (ORDER == 2) {
           pmb->precon->PiecewiseLinearX2(k, j, il, iu, r, rlb_, rr_);
         } else {
           pmb->precon->PiecewiseParabolicX2(k, j, il, iu, r, rlb_, rr_);
@@ -195,7 +217,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
 
         ComputeUpwindFlux(k, j, il, iu, rl_, rr_, mass_flux, x2flux);
 
-        if (order == 4) {
+        if (ORDER == 4) {
           for (int n=0; n<NSCALARS; n++) {
             for (int i=il; i<=iu; i++) {
               rl3d_(n,k,j,i) = rl_(n,i);
@@ -208,7 +230,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
         rl_.SwapAthenaArray(rlb_);
       }
     }
-    if (order == 4) {
+    if (ORDER == 4) {
       // TODO(felker): assuming uniform mesh with dx1f=dx2f=dx3f, so factor this out
       // TODO(felker): also, this may need to be dx2v, since Laplacian is cell-centered
       Real h = pmb->pcoord->dx2f(js);  // pco->dx2f(j); inside loop
@@ -245,7 +267,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
           }
         }
       }
-    } // end if (order == 4)
+    } // end if (ORDER == 4)
   }
 
   //--------------------------------------------------------------------------------------
@@ -263,9 +285,9 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
 
     for (int j=jl; j<=ju; ++j) { // this loop ordering is intentional
       // reconstruct the first row
-      if (order == 1) {
+      if (ORDER == 1) {
         pmb->precon->DonorCellX3(ks-1, j, il, iu, r, rl_, rr_);
-      } else if (order == 2) {
+      } else if (ORDER == 2) {
         pmb->precon->PiecewiseLinearX3(ks-1, j, il, iu, r, rl_, rr_);
       } else {
         pmb->precon->PiecewiseParabolicX3(ks-1, j, il, iu, r, rl_, rr_);
@@ -279,9 +301,9 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
       }
       for (int k=ks; k<=ke+1; ++k) {
         // reconstruct L/R states at k
-        if (order == 1) {
+        if (ORDER == 1) {
           pmb->precon->DonorCellX3(k, j, il, iu, r, rlb_, rr_);
-        } else if (order == 2) {
+        } else if (ORDER == 2) {
           pmb->precon->PiecewiseLinearX3(k, j, il, iu, r, rlb_, rr_);
         } else {
           pmb->precon->PiecewiseParabolicX3(k, j, il, iu, r, rlb_, rr_);
@@ -296,7 +318,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
 
         ComputeUpwindFlux(k, j, il, iu, rl_, rr_, mass_flux, x3flux);
 
-        if (order == 4) {
+        if (ORDER == 4) {
           for (int n=0; n<NSCALARS; n++) {
             for (int i=il; i<=iu; i++) {
               rl3d_(n,k,j,i) = rl_(n,i);
@@ -309,7 +331,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
         rl_.SwapAthenaArray(rlb_);
       }
     }
-    if (order == 4) {
+    if (ORDER == 4) {
       // TODO(felker): assuming uniform mesh with dx1f=dx2f=dx3f, so factor this out
       // TODO(felker): also, this may need to be dx3v, since Laplacian is cell-centered
       Real h = pmb->pcoord->dx3f(ks);  // pco->dx3f(j); inside loop
@@ -346,7 +368,7 @@ void PassiveScalars::CalculateFluxes(AthenaArray<Real> &r, const int order) {
           }
         }
       }
-    } // end if (order == 4)
+    } // end if (ORDER == 4)
   }
 
   if (!STS_ENABLED) {
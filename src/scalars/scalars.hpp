@@ -54,6 +54,8 @@ class PassiveScalars {
   // public functions:
   // KGF: use inheritance for these functions / overall class?
   void AddFluxDivergence(const Real wght, AthenaArray<Real> &s_out);
+  void WeightedAveFluxDivergence(const Real wght_s1[5], const Real wght_s[5],
+                                 const Real wght);
   void AddFluxDivergence_STS(const Real wght, int stage,
                              AthenaArray<Real> &s_out, AthenaArray<Real> &s_flux_div_out);
   void CalculateFluxes(AthenaArray<Real> &s, const int order);
@@ -103,7 +105,11 @@ class PassiveScalars {
                          AthenaArray<Real> &rl, AthenaArray<Real> &rr,
                          AthenaArray<Real> &mass_flx,
                          AthenaArray<Real> &flx_out);
+  template <int ORDER>
+  void CalculateFluxesPipeline(AthenaArray<Real> &r);
   void AddDiffusionFluxes();
+  void AddPencilFluxDivergence(const Real wght, const int k, const int j,
+                               AthenaArray<Real> &s_out);
   // TODO(felker): dedpulicate these arrays and the same named ones in HydroDiffusion
   AthenaArray<Real> dx1_, dx2_, dx3_;
 };
@@ -39,6 +39,8 @@ FFTGravitySolverTaskList::FFTGravitySolverTaskList(ParameterInput *pin, Mesh *pm
     AddTask(GRAV_PHYS_BND,SETB_GRAV_BND);
     AddTask(CLEAR_GRAV, GRAV_PHYS_BND);
   } // end of using namespace block
+  graph_.Compile(task_list_, ntasks);
+  InitProfiler(pm->ptprof, "FFTGravitySolverTaskList");
 }
 
 //----------------------------------------------------------------------------------------
@@ -55,22 +57,27 @@ void FFTGravitySolverTaskList::AddTask(const TaskID& id, const TaskID& dep) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&FFTGravitySolverTaskList::ClearFFTGravityBoundary);
+    task_list_[ntasks].name = "ClearFFTGravityBoundary";
   } else if (id == SEND_GRAV_BND) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&FFTGravitySolverTaskList::SendFFTGravityBoundary);
+    task_list_[ntasks].name = "SendFFTGravityBoundary";
   } else if (id == RECV_GRAV_BND) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&FFTGravitySolverTaskList::ReceiveFFTGravityBoundary);
+    task_list_[ntasks].name = "ReceiveFFTGravityBoundary";
   } else if (id == SETB_GRAV_BND) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&FFTGravitySolverTaskList::SetFFTGravityBoundary);
+    task_list_[ntasks].name = "SetFFTGravityBoundary";
   } else if (id == GRAV_PHYS_BND) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&FFTGravitySolverTaskList::PhysicalBoundary);
+    task_list_[ntasks].name = "PhysicalBoundary";
   } else {
     std::stringstream msg;
     msg << "### FATAL ERROR in FFTGravitySolverTaskList::AddTask" << std::endl
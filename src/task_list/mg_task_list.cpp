@@ -33,7 +33,17 @@ void MultigridTaskList::DoTaskListOneStage(MultigridDriver *pmd) {
 
   for (auto itr = pmd->vmg_.begin(); itr<pmd->vmg_.end(); itr++) {
     Multigrid *pmg = *itr;
-    pmg->ts_.Reset(ntasks);
+    pmg->ts_.Reset(graph_);
+  }
+
+  // the list changes between calls, so the profiler slots are looked up every time
+  if (pmd->pmy_mesh_->ptprof != nullptr) {
+    if (pprof_ == nullptr) {
+      pprof_ = pmd->pmy_mesh_->ptprof;
+      prof_list_ = pprof_->AddList("MultigridTaskList", nullptr, nullptr);
+    }
+    for (int i=0; i<ntasks; i++)
+      prof_slot_[i] = pprof_->GetSlot(prof_list_, task_list_[i].name);
   }
 
   // cycle through all MeshBlocks and perform all tasks possible
@@ -55,31 +65,22 @@ void MultigridTaskList::DoTaskListOneStage(MultigridDriver *pmd) {
 //! cleared) in this TaskList, return status.
 
 TaskListStatus MultigridTaskList::DoAllAvailableTasks(Multigrid *pmg, TaskStates &ts) {
-  int skip=0;
   TaskStatus ret;
 
   if (ts.num_tasks_left==0) return TaskListStatus::nothing_to_do;
 
-  for (int i=ts.indx_first_task; i<ntasks; i++) {
-    MGTask &taski=task_list_[i];
-
-    if (ts.finished_tasks.IsUnfinished(taski.task_id)) { // task not done
-      // check if dependency clear
-      if (ts.finished_tasks.CheckDependencies(taski.dependency)) {
-        ret=(this->*task_list_[i].TaskFunc)(pmg);
-        if (ret!=TaskStatus::fail) { // success
-          ts.num_tasks_left--;
-          ts.finished_tasks.SetFinished(taski.task_id);
-          if (skip==0) ts.indx_first_task++;
-          if (ts.num_tasks_left==0) return TaskListStatus::complete;
-          if (ret==TaskStatus::next) continue;
-          return TaskListStatus::running;
-        }
-      }
-      skip++; // increment number of tasks processed
-
-    } else if (skip==0) { // this task is already done AND it is at the top of the list
-      ts.indx_first_task++;
+  for (int i=ts.NextReady(0); i>=0; i=ts.NextReady(i+1)) {
+    double tstart = (pprof_ != nullptr) ? TaskProfiler::Now() : 0.0;
+    ret=(this->*task_list_[i].TaskFunc)(pmg);
+    if (pprof_ != nullptr) {
+      int gid = (pmg->pmy_block_ != nullptr) ? pmg->pmy_block_->gid : -1;
+      pprof_->Record(prof_slot_[i], 0, gid, tstart, TaskProfiler::Now(), ret);
+    }
+    if (ret!=TaskStatus::fail) { // success
+      ts.SetFinished(i, graph_);
+      if (ts.num_tasks_left==0) return TaskListStatus::complete;
+      if (ret==TaskStatus::next) continue;
+      return TaskListStatus::running;
     }
   }
   // there are still tasks to do but nothing can be done now
@@ -101,75 +102,92 @@ void MultigridTaskList::AddMultigridTask(const TaskID& id, const TaskID& dep) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::StartReceiveFluxCons);
+      task_list_[ntasks].name = "StartReceiveFluxCons";
   } else if (id == MG_STARTRECVP) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::StartReceiveForProlongation);
+      task_list_[ntasks].name = "StartReceiveForProlongation";
   } else if (id == MG_CLEARBNDP) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::ClearBoundary);
+      task_list_[ntasks].name = "ClearBoundary";
   } else if (id == MG_CLEARBND0  || id == MG_CLEARBND1R || id == MG_CLEARBND1B
           || id == MG_CLEARBND2R || id == MG_CLEARBND2B || id == MG_CLEARBNDL) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::ClearBoundaryFluxCons);
+      task_list_[ntasks].name = "ClearBoundaryFluxCons";
   } else if (id == MG_SENDBND0  || id == MG_SENDBND1R || id == MG_SENDBND1B
           || id == MG_SENDBND2R || id == MG_SENDBND2B || id == MG_SENDBNDL) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::SendBoundaryFluxCons);
+      task_list_[ntasks].name = "SendBoundaryFluxCons";
   } else if (id == MG_SENDBNDP) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::SendBoundaryForProlongation);
+      task_list_[ntasks].name = "SendBoundaryForProlongation";
   } else if (id == MG_RECVBND0  || id == MG_RECVBND1R || id == MG_RECVBND1B
           || id == MG_RECVBND2R || id == MG_RECVBND2B || id == MG_RECVBNDL) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::ReceiveBoundaryFluxCons);
+      task_list_[ntasks].name = "ReceiveBoundaryFluxCons";
   } else if (id == MG_RECVBNDP) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::ReceiveBoundaryForProlongation);
+      task_list_[ntasks].name = "ReceiveBoundaryForProlongation";
   } else if (id == MG_PRLNGBNDP) {
       task_list_[ntasks].TaskFunc=
           static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
           (&MultigridTaskList::ProlongateBoundaryForProlongation);
+      task_list_[ntasks].name = "ProlongateBoundaryForProlongation";
   } else if (id == MG_PRLNGFC0  || id == MG_PRLNGFC1R || id == MG_PRLNGFC1B
           || id == MG_PRLNGFC2R || id == MG_PRLNGFC2B || id == MG_PRLNGFCL) {
       task_list_[ntasks].TaskFunc=
           static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
           (&MultigridTaskList::ProlongateBoundary);
+      task_list_[ntasks].name = "ProlongateBoundary";
   } else if (id == MG_SMOOTH1R || id == MG_SMOOTH2R) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::SmoothRed);
+      task_list_[ntasks].name = "SmoothRed";
   } else if (id == MG_SMOOTH1B || id == MG_SMOOTH2B) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::SmoothBlack);
+      task_list_[ntasks].name = "SmoothBlack";
   } else if (id == MG_PHYSBND0  || id == MG_PHYSBND1R || id == MG_PHYSBND1B
           || id == MG_PHYSBND2R || id == MG_PHYSBND2B || id == MG_PHYSBNDL) {
       task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
         (&MultigridTaskList::PhysicalBoundary);
+      task_list_[ntasks].name = "PhysicalBoundary";
   } else if (id == MG_RESTRICT) {
       task_list_[ntasks].TaskFunc=
           static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
           (&MultigridTaskList::Restrict);
+      task_list_[ntasks].name = "Restrict";
   } else if (id == MG_PROLONG) {
       task_list_[ntasks].TaskFunc=
           static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
           (&MultigridTaskList::Prolongate);
+      task_list_[ntasks].name = "Prolongate";
   } else if (id == MG_FMGPROLONG) {
       task_list_[ntasks].TaskFunc=
           static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
           (&MultigridTaskList::FMGProlongate);
+      task_list_[ntasks].name = "FMGProlongate";
   } else if (id == MG_CALCFASRHS) {
       task_list_[ntasks].TaskFunc=
           static_cast<TaskStatus (MultigridTaskList::*)(Multigrid*)>
           (&MultigridTaskList::CalculateFASRHS);
+      task_list_[ntasks].name = "CalculateFASRHS";
   } else {
     std::stringstream msg;
     msg << "### FATAL ERROR in AddMultigridTask" << std::endl
@@ -384,6 +402,7 @@ void MultigridTaskList::SetMGTaskListToFiner(int nsmooth, int ngh, int flag) {
     }
     AddMultigridTask(MG_CLEARBNDL, MG_PHYSBNDL);
   }
+  graph_.Compile(task_list_, ntasks);
 }
 
 
@@ -515,6 +534,7 @@ void MultigridTaskList::SetMGTaskListToCoarser(int nsmooth, int ngh) {
     AddMultigridTask(MG_RESTRICT,    MG_PHYSBND0);
     AddMultigridTask(MG_CLEARBND0,   MG_RESTRICT);
   }
+  graph_.Compile(task_list_, ntasks);
 }
 
 
@@ -539,4 +559,5 @@ void MultigridTaskList::SetMGTaskListFMGProlongate(int flag) {
     AddMultigridTask(MG_FMGPROLONG, MG_PHYSBND0);
     AddMultigridTask(MG_CLEARBNDP,  MG_FMGPROLONG);
   }
+  graph_.Compile(task_list_, ntasks);
 }
@@ -31,6 +31,7 @@ struct MGTask {
   TaskID task_id;      //!> encodes task using bit positions in MultigridTaskNames
   TaskID dependency;   //!> encodes dependencies to other tasks using MultigridTaskNames
   TaskStatus (MultigridTaskList::*TaskFunc)(Multigrid*);  //!> ptr to a task
+  const char *name; //!> name of TaskFunc, used by the TaskProfiler
 };
 
 
@@ -41,7 +42,8 @@ struct MGTask {
 class MultigridTaskList {
  public:
   explicit MultigridTaskList(MultigridDriver *pmd) : ntasks(0), pmy_mgdriver_(pmd),
-                                                     task_list_{} {}
+                                                     task_list_{}, pprof_(nullptr),
+                                                     prof_list_(-1), prof_slot_{} {}
   // data
   int ntasks;     //!> number of tasks in this list
 
@@ -80,6 +82,10 @@ class MultigridTaskList {
  private:
   MultigridDriver* pmy_mgdriver_;
   MGTask task_list_[64*TaskID::kNField_];
+  TaskGraph graph_; //!> recompiled each time the list is set
+  TaskProfiler *pprof_;
+  int prof_list_;
+  int prof_slot_[TaskGraph::kMaxTasks];
 
   void AddMultigridTask(const TaskID& id, const TaskID& dep);
 };
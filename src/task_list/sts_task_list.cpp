@@ -336,6 +336,8 @@ SuperTimeStepTaskList::SuperTimeStepTaskList(
       AddTask(CLEAR_ALLBND,PHY_BVAL);
     }
   } // end of using namespace block
+  graph_.Compile(task_list_, ntasks);
+  InitProfiler(pm->ptprof, "SuperTimeStepTaskList");
 }
 
 //---------------------------------------------------------------------------------------
@@ -352,216 +354,259 @@ void SuperTimeStepTaskList::AddTask(const TaskID& id, const TaskID& dep) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::ClearAllBoundary_STS);
+    task_list_[ntasks].name = "ClearAllBoundary_STS";
     task_list_[ntasks].lb_time = false;
   } else if (id == CALC_HYDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::CalculateHydroFlux_STS);
+    task_list_[ntasks].name = "CalculateHydroFlux_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == CALC_FLDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::CalculateEMF_STS);
+    task_list_[ntasks].name = "CalculateEMF_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_HYDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydroFlux);
+    task_list_[ntasks].name = "SendHydroFlux";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_FLDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendEMF);
+    task_list_[ntasks].name = "SendEMF";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveAndCorrectHydroFlux);
+    task_list_[ntasks].name = "ReceiveAndCorrectHydroFlux";
     task_list_[ntasks].lb_time = false;
   } else if (id == RECV_FLDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveAndCorrectEMF);
+    task_list_[ntasks].name = "ReceiveAndCorrectEMF";
     task_list_[ntasks].lb_time = false;
   } else if (id == INT_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::IntegrateHydro_STS);
+    task_list_[ntasks].name = "IntegrateHydro_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == INT_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::IntegrateField_STS);
+    task_list_[ntasks].name = "IntegrateField_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydro);
+    task_list_[ntasks].name = "SendHydro";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendField);
+    task_list_[ntasks].name = "SendField";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveHydro);
+    task_list_[ntasks].name = "ReceiveHydro";
     task_list_[ntasks].lb_time = false;
   } else if (id == RECV_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveField);
+    task_list_[ntasks].name = "ReceiveField";
     task_list_[ntasks].lb_time = false;
   } else if (id == SETB_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SetBoundariesHydro);
+    task_list_[ntasks].name = "SetBoundariesHydro";
     task_list_[ntasks].lb_time = true;
   } else if (id == SETB_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SetBoundariesField);
+    task_list_[ntasks].name = "SetBoundariesField";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_HYDFLXSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydroFluxShear);
+    task_list_[ntasks].name = "SendHydroFluxShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYDFLXSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveHydroFluxShear);
+    task_list_[ntasks].name = "ReceiveHydroFluxShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == SEND_HYDSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydroShear);
+    task_list_[ntasks].name = "SendHydroShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYDSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveHydroShear);
+    task_list_[ntasks].name = "ReceiveHydroShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == SEND_FLDSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendFieldShear);
+    task_list_[ntasks].name = "SendFieldShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_FLDSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveFieldShear);
+    task_list_[ntasks].name = "ReceiveFieldShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == SEND_EMFSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendEMFShear);
+    task_list_[ntasks].name = "SendEMFShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_EMFSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveEMFShear);
+    task_list_[ntasks].name = "ReceiveEMFShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == CALC_SCLRFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::CalculateScalarFlux_STS);
+    task_list_[ntasks].name = "CalculateScalarFlux_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_SCLRFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendScalarFlux);
+    task_list_[ntasks].name = "SendScalarFlux";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_SCLRFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveScalarFlux);
+    task_list_[ntasks].name = "ReceiveScalarFlux";
     task_list_[ntasks].lb_time = false;
   } else if (id == INT_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::IntegrateScalars_STS);
+    task_list_[ntasks].name = "IntegrateScalars_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendScalars);
+    task_list_[ntasks].name = "SendScalars";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveScalars);
+    task_list_[ntasks].name = "ReceiveScalars";
     task_list_[ntasks].lb_time = false;
   } else if (id == SETB_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SetBoundariesScalars);
+    task_list_[ntasks].name = "SetBoundariesScalars";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_SCLRSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendScalarsShear);
+    task_list_[ntasks].name = "SendScalarsShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_SCLRSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveScalarsShear);
+    task_list_[ntasks].name = "ReceiveScalarsShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == SEND_SCLRFLXSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendScalarsFluxShear);
+    task_list_[ntasks].name = "SendScalarsFluxShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_SCLRFLXSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveScalarsFluxShear);
+    task_list_[ntasks].name = "ReceiveScalarsFluxShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == PROLONG) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::Prolongation_STS);
+    task_list_[ntasks].name = "Prolongation_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == CONS2PRIM) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::Primitives_STS);
+    task_list_[ntasks].name = "Primitives_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == USERWORK) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::UserWork_STS);
+    task_list_[ntasks].name = "UserWork_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == NEW_DT) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::NewBlockTimeStep_STS);
+    task_list_[ntasks].name = "NewBlockTimeStep_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == FLAG_AMR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::CheckRefinement_STS);
+    task_list_[ntasks].name = "CheckRefinement_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == PHY_BVAL) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&SuperTimeStepTaskList::PhysicalBoundary_STS);
+    task_list_[ntasks].name = "PhysicalBoundary_STS";
     task_list_[ntasks].lb_time = true;
   } else if (id == DIFFUSE_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::DiffuseHydro);
+    task_list_[ntasks].name = "DiffuseHydro";
     task_list_[ntasks].lb_time = true;
   } else if (id == DIFFUSE_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::DiffuseField);
+    task_list_[ntasks].name = "DiffuseField";
     task_list_[ntasks].lb_time = true;
   } else if (id == DIFFUSE_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::DiffuseScalars);
+    task_list_[ntasks].name = "DiffuseScalars";
     task_list_[ntasks].lb_time = true;
   } else {
     std::stringstream msg;
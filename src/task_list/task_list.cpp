@@ -8,9 +8,15 @@
 
 
 // C headers
+#include <sched.h>  // sched_yield() (POSIX)
 
 // C++ headers
-//#include <vector> // formerly needed for vector of MeshBlock ptrs in DoTaskListOneStage
+#include <cstddef>    // std::size_t
+#include <iostream>   // endl
+#include <sstream>    // stringstream
+#include <stdexcept>  // runtime_error
+#include <string>     // std::string
+#include <vector>     // std::vector
 
 // Athena++ headers
 #include "../athena.hpp"
@@ -22,69 +28,170 @@
 #include <omp.h>
 #endif
 
+//----------------------------------------------------------------------------------------
+//! \fn void TaskGraph::Build(const std::vector<TaskID> &id,
+//!                           const std::vector<TaskID> &dep)
+//! \brief find the tasks that each task depends on from the bit fields, and store the
+//! in-degrees and successor lists. Every bit of a dependency must match a task.
+
+void TaskGraph::Build(const std::vector<TaskID> &id, const std::vector<TaskID> &dep) {
+  ntasks_ = static_cast<int>(id.size());
+  for (int n=0; n<kNWord; n++)
+    ready0_[n] = 0ULL;
+  for (int i=0; i<=ntasks_; i++)
+    succ_begin_[i] = 0;
+
+  // count the dependencies and successors of each task, and check the bit fields
+  for (int i=0; i<ntasks_; i++) {
+    TaskID found(0);
+    ndep_[i] = 0;
+    for (int j=0; j<ntasks_; j++) {
+      if (j != i && id[j] == id[i]) {
+        std::stringstream msg;
+        msg << "### FATAL ERROR in TaskGraph::Build" << std::endl
+            << "Task " << i << " and task " << j << " have the same TaskID" << std::endl;
+        ATHENA_ERROR(msg);
+      }
+      if (dep[i].CheckDependencies(id[j])) {
+        succ_begin_[j+1]++;
+        ndep_[i]++;
+        found = found | id[j];
+      }
+    }
+    if (!(found == dep[i]) || dep[i].CheckDependencies(id[i])) {
+      std::stringstream msg;
+      msg << "### FATAL ERROR in TaskGraph::Build" << std::endl
+          << "Task " << i << " depends on itself or on a task that is not in the list"
+          << std::endl;
+      ATHENA_ERROR(msg);
+    }
+    if (ndep_[i] == 0) ready0_[i/64] |= (1ULL << (i%64));
+  }
+
+  // fill the successor lists; each list is in task order
+  for (int i=0; i<ntasks_; i++)
+    succ_begin_[i+1] += succ_begin_[i];
+  succ_.resize(succ_begin_[ntasks_]);
+  int fill[kMaxTasks];
+  for (int j=0; j<ntasks_; j++)
+    fill[j] = succ_begin_[j];
+  for (int i=0; i<ntasks_; i++) {
+    for (int j=0; j<ntasks_; j++) {
+      if (dep[i].CheckDependencies(id[j])) succ_[fill[j]++] = i;
+    }
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn TaskListStatus TaskList::DoAllAvailableTasks
 //! \brief do all tasks that can be done (are not waiting for a dependency to be
 //! cleared) in this TaskList, return status.
+//!
+//! Only the ready tasks are visited, in the order they were added to the list.
 
 TaskListStatus TaskList::DoAllAvailableTasks(MeshBlock *pmb, int stage, TaskStates &ts) {
-  int skip = 0;
   TaskStatus ret;
   if (ts.num_tasks_left == 0) return TaskListStatus::nothing_to_do;
 
-  for (int i=ts.indx_first_task; i<ntasks; i++) {
+  for (int i=ts.NextReady(0); i>=0; i=ts.NextReady(i+1)) {
     Task &taski = task_list_[i];
-    if (ts.finished_tasks.IsUnfinished(taski.task_id)) { // task not done
-      // check if dependency clear
-      if (ts.finished_tasks.CheckDependencies(taski.dependency)) {
-        if (taski.lb_time) pmb->StartTimeMeasurement();
-        ret = (this->*task_list_[i].TaskFunc)(pmb, stage);
-        if (taski.lb_time) pmb->StopTimeMeasurement();
-        if (ret != TaskStatus::fail) { // success
-          ts.num_tasks_left--;
-          ts.finished_tasks.SetFinished(taski.task_id);
-          if (skip == 0) ts.indx_first_task++;
-          if (ts.num_tasks_left == 0) return TaskListStatus::complete;
-          if (ret == TaskStatus::next) continue;
-          return TaskListStatus::running;
-        }
-      }
-      skip++; // increment number of tasks processed
-
-    } else if (skip == 0) { // this task is already done AND it is at the top of the list
-      ts.indx_first_task++;
+    double tstart = (pprof_ != nullptr) ? TaskProfiler::Now() : 0.0;
+    if (taski.lb_time) pmb->StartTimeMeasurement();
+    ret = (this->*task_list_[i].TaskFunc)(pmb, stage);
+    if (taski.lb_time) pmb->StopTimeMeasurement();
+    if (pprof_ != nullptr)
+      pprof_->Record(prof_slot_[i], stage, pmb->gid, tstart, TaskProfiler::Now(), ret);
+    if (ret != TaskStatus::fail) { // success
+      ts.SetFinished(i, graph_);
+      if (ts.num_tasks_left == 0) return TaskListStatus::complete;
+      if (ret == TaskStatus::next) continue;
+      return TaskListStatus::running;
     }
   }
   // there are still tasks to do but nothing can be done now
   return TaskListStatus::stuck;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void TaskList::InitProfiler(TaskProfiler *pprof, const std::string &name)
+//! \brief register this list with the profiler (if any). Call after the list is compiled.
+
+void TaskList::InitProfiler(TaskProfiler *pprof, const std::string &name) {
+  pprof_ = pprof;
+  if (pprof_ == nullptr) return;
+  int list = pprof_->AddList(name, &graph_, prof_slot_);
+  for (int i=0; i<ntasks; i++)
+    prof_slot_[i] = pprof_->GetSlot(list, task_list_[i].name);
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void TaskList::DoTaskListOneStage(Mesh *pmesh, int stage)
 //! \brief completes all tasks in this list, will not return until all are tasks done
+//!
+//! A single persistent OpenMP parallel region executes the stage. Each thread works
+//! through its own queue of MeshBlocks and steals from the other threads when its queue
+//! is empty. Blocks that are stuck waiting for boundary data are parked instead of being
+//! swept repeatedly, and are re-armed when a neighbor on the same rank delivers data, or
+//! when the thread runs out of other work and has to poll for MPI messages.
 
 void TaskList::DoTaskListOneStage(Mesh *pmesh, int stage) {
   int nthreads = pmesh->GetNumMeshThreads();
   int nmb = pmesh->nblocal;
+  int nmb_left = nmb;
 
-  // clear the task states, startup the integrator and initialize mpi calls
-#pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
-  for (int i=0; i<nmb; ++i) {
-    pmesh->my_blocks(i)->tasks.Reset(ntasks);
-    StartupTaskList(pmesh->my_blocks(i), stage);
-  }
+  sched_.Assign(nthreads, nmb);
 
-  int nmb_left = nmb;
-  // cycle through all MeshBlocks and perform all tasks possible
-  while (nmb_left > 0) {
-    //! \note
-    //! KNOWN ISSUE: Workaround for unknown OpenMP race condition. See #183 on GitHub.
-#pragma omp parallel for reduction(- : nmb_left) num_threads(nthreads) schedule(dynamic,1)
+#pragma omp parallel num_threads(nthreads)
+  {
+    // clear the task states, startup the integrator and initialize mpi calls
+    // (the implicit barrier guarantees all receives are posted before any send)
+#pragma omp for schedule(dynamic,1)
     for (int i=0; i<nmb; ++i) {
-      if (DoAllAvailableTasks(pmesh->my_blocks(i), stage, pmesh->my_blocks(i)->tasks)
-          == TaskListStatus::complete) {
-        nmb_left--;
+      pmesh->my_blocks(i)->tasks.Reset(graph_);
+      StartupTaskList(pmesh->my_blocks(i), stage);
+    }
+
+#ifdef OPENMP_PARALLEL
+    int tid = omp_get_thread_num();
+#else
+    int tid = 0;
+#endif
+    std::vector<int> &parked = sched_.Parked(tid);
+    int left = nmb;
+    while (left > 0) {
+      int i;
+      if (sched_.GetWork(tid, i)) {
+        MeshBlock *pmb = pmesh->my_blocks(i);
+        pmb->tasks.TestAndClearWakeup();
+        TaskListStatus ret = DoAllAvailableTasks(pmb, stage, pmb->tasks);
+        if (ret == TaskListStatus::complete || ret == TaskListStatus::nothing_to_do) {
+#pragma omp atomic
+          nmb_left--;
+        } else if (ret == TaskListStatus::running) {
+          sched_.Requeue(tid, i);
+        } else {
+          sched_.Park(tid, i);
+        }
+        // re-arm the parked blocks that received data from a neighbor in the meantime
+        for (std::size_t n=0; n<parked.size(); ) {
+          if (pmesh->my_blocks(parked[n])->tasks.TestAndClearWakeup()) {
+            sched_.Requeue(tid, parked[n]);
+            parked[n] = parked.back();
+            parked.pop_back();
+          } else {
+            ++n;
+          }
+        }
+      } else {
+        // nothing else to do: poll all parked blocks (required for MPI receives), and
+        // give up the core in case the threads are oversubscribed
+        sched_.RearmAll(tid);
+        sched_yield();
       }
+#pragma omp atomic read
+      left = nmb_left;
     }
   }
   return;
@@ -17,6 +17,8 @@
 
 // Athena++ headers
 #include "../athena.hpp"
+#include "task_profiler.hpp"
+#include "task_scheduler.hpp"
 
 // forward declarations
 class Mesh;
@@ -54,6 +56,7 @@ class TaskID {  // POD but not aggregate (there is a user-provided ctor)
 
   friend class TaskList;
   friend class MultigridTaskList;
+  friend class TaskGraph;
 };
 
 
@@ -67,19 +70,117 @@ struct Task { // aggregate and POD
                      //!> HydroIntegratorTaskNames
   TaskStatus (TaskList::*TaskFunc)(MeshBlock*, int);  //!> ptr to member function
   bool lb_time; //!> flag for automatic load balancing based on timing
+  const char *name; //!> name of TaskFunc, used by the TaskProfiler
 };
 
+//----------------------------------------------------------------------------------------
+//! \class TaskGraph
+//! \brief dependency DAG of a task list, compiled once from the task_id/dependency bit
+//! fields passed to AddTask.
+//!
+//! Tasks are identified by their index in the task list. For each task, the graph stores
+//! the number of tasks it depends on (in-degree) and the list of tasks that depend on it
+//! (successors), so that TaskStates can track which tasks are ready without rescanning
+//! the whole list.
+
+class TaskGraph {
+ public:
+  constexpr static int kMaxTasks = 64*TaskID::kNField_;
+  constexpr static int kNWord = TaskID::kNField_;
+
+  TaskGraph() : ntasks_(0), ndep_{}, succ_begin_{}, ready0_{} {}
+
+  template <typename T> void Compile(const T *tasks, int ntasks);
+
+  int NumTasks() const {return ntasks_;}
+  int NumDependencies(int i) const {return ndep_[i];}
+  const int *SuccessorsBegin(int i) const {return succ_.data() + succ_begin_[i];}
+  const int *SuccessorsEnd(int i) const {return succ_.data() + succ_begin_[i+1];}
+  std::uint64_t InitialReady(int n) const {return ready0_[n];}
+
+ private:
+  int ntasks_;
+  int ndep_[kMaxTasks];           //!> number of direct dependencies of each task
+  int succ_begin_[kMaxTasks+1];   //!> offsets of the successor lists in succ_
+  std::vector<int> succ_;         //!> successor lists of all tasks, in task order
+  std::uint64_t ready0_[kNWord];  //!> tasks without dependencies, one bit per index
+
+  void Build(const std::vector<TaskID> &id, const std::vector<TaskID> &dep);
+};
+
+//----------------------------------------------------------------------------------------
+//! \fn template <typename T> void TaskGraph::Compile(const T *tasks, int ntasks)
+//! \brief compile the dependency graph of an array of Task or MGTask
+
+template <typename T>
+void TaskGraph::Compile(const T *tasks, int ntasks) {
+  std::vector<TaskID> id(ntasks), dep(ntasks);
+  for (int i=0; i<ntasks; i++) {
+    id[i] = tasks[i].task_id;
+    dep[i] = tasks[i].dependency;
+  }
+  Build(id, dep);
+  return;
+}
+
 //---------------------------------------------------------------------------------------
 //! \struct TaskStates
 //! \brief container for task states on a single MeshBlock
+//!
+//! npending counts the unfinished dependencies of each task, and the ready bit field
+//! holds the unfinished tasks whose dependencies are all cleared, by index in the list.
 
 struct TaskStates { // aggregate and POD
-  TaskID finished_tasks;
-  int indx_first_task, num_tasks_left;
-  void Reset(int ntasks) {
-    indx_first_task = 0;
-    num_tasks_left = ntasks;
-    finished_tasks.Clear();
+  int num_tasks_left;
+  int wakeup; //!> set by same-rank neighbors when they deliver data to this block
+  int npending[TaskGraph::kMaxTasks];
+  std::uint64_t ready[TaskGraph::kNWord];
+
+  void Reset(const TaskGraph &graph) {
+    num_tasks_left = graph.NumTasks();
+    for (int i=0; i<num_tasks_left; i++)
+      npending[i] = graph.NumDependencies(i);
+    for (int n=0; n<TaskGraph::kNWord; n++)
+      ready[n] = graph.InitialReady(n);
+    wakeup = 0;
+  }
+  //! index of the first ready task at or after index i, or -1 if there is none
+  int NextReady(int i) const {
+    for (int n=i/64; n<TaskGraph::kNWord; n++) {
+      std::uint64_t w = ready[n];
+      if (n == i/64) w &= (~0ULL << (i%64));
+      if (w != 0ULL) return 64*n + LowestSetBit(w);
+    }
+    return -1;
+  }
+  //! mark task i finished and release the successors whose dependencies are all cleared
+  void SetFinished(int i, const TaskGraph &graph) {
+    ready[i/64] &= ~(1ULL << (i%64));
+    num_tasks_left--;
+    for (const int *s=graph.SuccessorsBegin(i); s!=graph.SuccessorsEnd(i); ++s) {
+      if (--npending[*s] == 0) ready[*s/64] |= (1ULL << (*s%64));
+    }
+  }
+  //! called by another thread after it has written boundary data for this block
+  void Notify() {
+#pragma omp flush
+#pragma omp atomic write
+    wakeup = 1;
+  }
+  bool TestAndClearWakeup() {
+    int w;
+#pragma omp atomic capture
+    {w = wakeup; wakeup = 0;}
+    return (w != 0);
+  }
+  static int LowestSetBit(std::uint64_t w) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(w);
+#else
+    int b = 0;
+    for (; (w & 1ULL) == 0ULL; w >>= 1) b++;
+    return b;
+#endif
   }
 };
 
@@ -89,7 +190,7 @@ struct TaskStates { // aggregate and POD
 
 class TaskList {
  public:
-  TaskList() : ntasks(0), nstages(0), task_list_{} {} // 2x direct + zero initialization
+  TaskList() : ntasks(0), nstages(0), task_list_{}, pprof_(nullptr), prof_slot_{} {}
   // rule of five:
   virtual ~TaskList() = default;
 
@@ -104,8 +205,15 @@ class TaskList {
  protected:
   //! \todo (felker): rename to avoid confusion with class name
   Task task_list_[64*TaskID::kNField_];
+  TaskGraph graph_; //!> must be compiled after the last call to AddTask()
+
+  void InitProfiler(TaskProfiler *pprof, const std::string &name);
 
  private:
+  TaskProfiler *pprof_; //!> nullptr unless <profiler>/tasks = true
+  int prof_slot_[TaskGraph::kMaxTasks];
+  TaskScheduler sched_;
+
   virtual void AddTask(const TaskID& id, const TaskID& dep) = 0;
   virtual void StartupTaskList(MeshBlock *pmb, int stage) = 0;
 };
@@ -0,0 +1,307 @@
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file task_profiler.cpp
+//! \brief implementation of the TaskProfiler class
+
+// C headers
+#include <time.h>     // clock_gettime() (POSIX)
+
+// C++ headers
+#include <algorithm>  // std::max, std::max_element, std::reverse, std::sort
+#include <cinttypes>  // format macro "PRId64" for fixed-width integer type std::int64_t
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::int64_t
+#include <cstdio>     // std::fopen, std::fprintf, std::snprintf
+#include <iostream>   // endl
+#include <map>        // std::map
+#include <sstream>    // stringstream
+#include <stdexcept>  // runtime_error
+#include <string>     // std::string
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+// Athena++ headers
+#include "../athena.hpp"
+#include "../globals.hpp"
+#include "../parameter_input.hpp"
+#include "task_list.hpp"
+#include "task_profiler.hpp"
+
+#ifdef OPENMP_PARALLEL
+#include <omp.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+//! TaskProfiler constructor
+
+TaskProfiler::TaskProfiler(ParameterInput *pin, int nthreads) :
+    trace_(pin->GetOrAddBoolean("profiler", "trace", true)),
+    max_events_(pin->GetOrAddInteger("profiler", "max_trace_events", 100000)),
+    tbegin_(Now()), thread_(nthreads) {
+  char rank[16];
+  std::snprintf(rank, sizeof(rank), "%05d", Globals::my_rank);
+  basename_ = pin->GetString("job", "problem_id") + "." + rank;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn double TaskProfiler::Now()
+//! \brief monotonic wall clock time in seconds
+
+double TaskProfiler::Now() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) + 1.0e-9*static_cast<double>(ts.tv_nsec);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int TaskProfiler::AddList(const std::string &name, const TaskGraph *pgraph,
+//!                               const int *slot)
+//! \brief register a task list and return its index. If the graph is given, slot[i]
+//! must hold the slot of task i of the graph when Write() is called.
+
+int TaskProfiler::AddList(const std::string &name, const TaskGraph *pgraph,
+                          const int *slot) {
+  ListInfo info = {name, pgraph, slot};
+  lists_.push_back(info);
+  return static_cast<int>(lists_.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn int TaskProfiler::GetSlot(int list, const std::string &task_name)
+//! \brief return the slot of the statistics of a task, creating it if needed.
+//! Must not be called inside a parallel region.
+
+int TaskProfiler::GetSlot(int list, const std::string &task_name) {
+  std::pair<int, std::string> key(list, task_name);
+  auto it = slot_map_.find(key);
+  if (it != slot_map_.end()) return it->second;
+  int slot = static_cast<int>(slot_name_.size());
+  slot_map_[key] = slot;
+  slot_list_.push_back(list);
+  slot_name_.push_back(task_name);
+  return slot;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::Record(int slot, int stage, int gid, double tstart,
+//!                               double tstop, TaskStatus ret)
+//! \brief record one call to a task in the data of the calling thread
+
+void TaskProfiler::Record(int slot, int stage, int gid, double tstart, double tstop,
+                          TaskStatus ret) {
+#ifdef OPENMP_PARALLEL
+  int tid = omp_get_thread_num();
+#else
+  int tid = 0;
+#endif
+  if (tid >= static_cast<int>(thread_.size())) return;
+  ThreadData &td = thread_[tid];
+  if (slot >= static_cast<int>(td.times.size())) td.times.resize(slot+1);
+  std::vector<TaskTimes> &st = td.times[slot];
+  if (stage >= static_cast<int>(st.size())) st.resize(stage+1, TaskTimes());
+
+  double dt = tstop - tstart;
+  TaskTimes &t = st[stage];
+  t.ncall++;
+  t.total += dt;
+  t.max = std::max(t.max, dt);
+  if (ret == TaskStatus::fail) {
+    t.nfail++;
+    t.fail += dt;
+  } else if (trace_) {
+    if (static_cast<std::int64_t>(td.events.size()) < max_events_) {
+      TraceEvent ev = {tstart - tbegin_, dt, slot, stage, gid};
+      td.events.push_back(ev);
+    } else {
+      td.ndropped++;
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::Write()
+//! \brief write the summary and the trace of this rank. Call outside parallel regions.
+
+void TaskProfiler::Write() {
+  std::vector<std::vector<TaskTimes>> times;
+  MergeThreads(times);
+  WriteSummary(times);
+  if (trace_) WriteTrace();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::MergeThreads(std::vector<std::vector<TaskTimes>> &times)
+//! \brief sum the statistics of all threads, indexed by [slot][stage]
+
+void TaskProfiler::MergeThreads(std::vector<std::vector<TaskTimes>> &times) {
+  times.assign(slot_name_.size(), std::vector<TaskTimes>());
+  for (const ThreadData &td : thread_) {
+    for (std::size_t s=0; s<td.times.size(); ++s) {
+      if (td.times[s].size() > times[s].size())
+        times[s].resize(td.times[s].size(), TaskTimes());
+      for (std::size_t n=0; n<td.times[s].size(); ++n) {
+        const TaskTimes &src = td.times[s][n];
+        TaskTimes &dst = times[s][n];
+        dst.ncall += src.ncall;
+        dst.nfail += src.nfail;
+        dst.total += src.total;
+        dst.fail += src.fail;
+        dst.max = std::max(dst.max, src.max);
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::WriteSummary(const std::vector<std::vector<TaskTimes>> &times)
+//! \brief write the per-task statistics and the critical path of each task list
+
+void TaskProfiler::WriteSummary(const std::vector<std::vector<TaskTimes>> &times) {
+  std::string fname = basename_ + ".task_profile.txt";
+  FILE *pfile;
+  if ((pfile = std::fopen(fname.c_str(), "w")) == nullptr) {
+    std::stringstream msg;
+    msg << "### FATAL ERROR in function [TaskProfiler::WriteSummary]" << std::endl
+        << "Output file '" << fname << "' could not be opened";
+    ATHENA_ERROR(msg);
+  }
+  std::int64_t ndropped = 0;
+  for (const ThreadData &td : thread_)
+    ndropped += td.ndropped;
+  std::fprintf(pfile, "# Athena++ task profile: rank %d of %d, %d thread(s), "
+               "%.6e s wall time\n", Globals::my_rank, Globals::nranks,
+               static_cast<int>(thread_.size()), Now() - tbegin_);
+  std::fprintf(pfile, "# calls include the failed calls (task waiting for data); "
+               "mean is the time per completed call\n");
+  if (ndropped > 0)
+    std::fprintf(pfile, "# %" PRId64 " trace events dropped, increase "
+                 "<profiler>/max_trace_events\n", ndropped);
+
+  for (int l=0; l<static_cast<int>(lists_.size()); ++l) {
+    // sum over stages
+    std::vector<TaskTimes> all(slot_name_.size(), TaskTimes());
+    std::vector<int> order;
+    double list_total = 0.0;
+    for (std::size_t s=0; s<times.size(); ++s) {
+      if (slot_list_[s] != l) continue;
+      for (const TaskTimes &t : times[s]) {
+        all[s].ncall += t.ncall;
+        all[s].nfail += t.nfail;
+        all[s].total += t.total;
+        all[s].fail += t.fail;
+        all[s].max = std::max(all[s].max, t.max);
+      }
+      if (all[s].ncall > 0) order.push_back(static_cast<int>(s));
+      list_total += all[s].total;
+    }
+    if (order.empty()) continue;
+    std::sort(order.begin(), order.end(),
+              [&all](int a, int b) { return all[a].total > all[b].total; });
+
+    std::fprintf(pfile, "\n# task list: %s, total %.6e s\n", lists_[l].name.c_str(),
+                 list_total);
+    std::fprintf(pfile, "# %-30s %6s %12s %12s %12s %12s %12s %12s %7s\n", "task",
+                 "stage", "calls", "fail_calls", "total[s]", "fail[s]", "mean[us]",
+                 "max[us]", "share");
+    for (int pass=0; pass<2; ++pass) { // all stages, then each stage separately
+      for (int s : order) {
+        int nstage = (pass == 0) ? 1 : static_cast<int>(times[s].size());
+        for (int n=0; n<nstage; ++n) {
+          const TaskTimes &t = (pass == 0) ? all[s] : times[s][n];
+          if (t.ncall == 0) continue;
+          std::int64_t ndone = t.ncall - t.nfail;
+          double mean = (ndone > 0) ? (t.total - t.fail)/ndone : 0.0;
+          char stage[16];
+          std::snprintf(stage, sizeof(stage), "%d", n);
+          std::fprintf(pfile, "  %-30s %6s %12" PRId64 " %12" PRId64 " %12.5e %12.5e "
+                       "%12.5e %12.5e %6.2f%%\n", slot_name_[s].c_str(),
+                       (pass == 0) ? "all" : stage, t.ncall, t.nfail,
+                       t.total, t.fail, 1.0e6*mean, 1.0e6*t.max,
+                       100.0*t.total/std::max(list_total, TINY_NUMBER));
+        }
+      }
+    }
+
+    // longest path through the dependency graph, weighting each task by its time per
+    // completed call (including the failed calls), i.e. the minimum time per MeshBlock
+    // and stage if all other work could be perfectly overlapped
+    const TaskGraph *pg = lists_[l].pgraph;
+    if (pg == nullptr || pg->NumTasks() == 0) continue;
+    int ntask = pg->NumTasks();
+    std::vector<double> w(ntask), dist(ntask);
+    std::vector<int> pred(ntask, -1), ndep(ntask), ready;
+    for (int i=0; i<ntask; ++i) {
+      const TaskTimes &t = all[lists_[l].slot[i]];
+      std::int64_t ndone = t.ncall - t.nfail;
+      w[i] = (ndone > 0) ? t.total/ndone : 0.0;
+      dist[i] = w[i];
+      ndep[i] = pg->NumDependencies(i);
+      if (ndep[i] == 0) ready.push_back(i);
+    }
+    while (!ready.empty()) {
+      int i = ready.back();
+      ready.pop_back();
+      for (const int *s=pg->SuccessorsBegin(i); s!=pg->SuccessorsEnd(i); ++s) {
+        if (dist[i] + w[*s] > dist[*s]) {
+          dist[*s] = dist[i] + w[*s];
+          pred[*s] = i;
+        }
+        if (--ndep[*s] == 0) ready.push_back(*s);
+      }
+    }
+    int last = static_cast<int>(std::max_element(dist.begin(), dist.end())
+                                - dist.begin());
+    std::vector<int> path;
+    for (int i=last; i>=0; i=pred[i])
+      path.push_back(i);
+    std::reverse(path.begin(), path.end());
+    std::fprintf(pfile, "# critical path per MeshBlock and stage: %.5e us\n",
+                 1.0e6*dist[last]);
+    for (int i : path)
+      std::fprintf(pfile, "  %-30s %12.5e us\n",
+                   slot_name_[lists_[l].slot[i]].c_str(), 1.0e6*w[i]);
+  }
+  std::fclose(pfile);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskProfiler::WriteTrace()
+//! \brief write the completed task calls in the Chrome trace event format, with one
+//! process per rank and one track per OpenMP thread. Times are relative to the
+//! construction of the profiler on each rank.
+
+void TaskProfiler::WriteTrace() {
+  std::string fname = basename_ + ".task_trace.json";
+  FILE *pfile;
+  if ((pfile = std::fopen(fname.c_str(), "w")) == nullptr) {
+    std::stringstream msg;
+    msg << "### FATAL ERROR in function [TaskProfiler::WriteTrace]" << std::endl
+        << "Output file '" << fname << "' could not be opened";
+    ATHENA_ERROR(msg);
+  }
+  int pid = Globals::my_rank;
+  std::fprintf(pfile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  std::fprintf(pfile, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+               "\"args\":{\"name\":\"rank %d\"}" "}", pid, pid);
+  for (int tid=0; tid<static_cast<int>(thread_.size()); ++tid) {
+    std::fprintf(pfile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                 "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}" "}", pid, tid, tid);
+    for (const TraceEvent &ev : thread_[tid].events) {
+      std::fprintf(pfile, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%d,"
+                   "\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,"
+                   "\"args\":{\"stage\":%d,\"block\":%d}" "}",
+                   slot_name_[ev.slot].c_str(), lists_[slot_list_[ev.slot]].name.c_str(),
+                   pid, tid, 1.0e6*ev.tstart, 1.0e6*ev.duration, ev.stage, ev.gid);
+    }
+  }
+  std::fprintf(pfile, "\n]}\n");
+  std::fclose(pfile);
+  return;
+}
@@ -0,0 +1,86 @@
+#ifndef TASK_LIST_TASK_PROFILER_HPP_
+#define TASK_LIST_TASK_PROFILER_HPP_
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file task_profiler.hpp
+//! \brief opt-in profiler of the execution of individual tasks in the task lists
+
+// C headers
+
+// C++ headers
+#include <cstdint>    // std::int64_t
+#include <map>        // std::map
+#include <string>     // std::string
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+// Athena++ headers
+#include "../athena.hpp"
+
+// forward declarations
+class ParameterInput;
+class TaskGraph;
+enum class TaskStatus;
+
+//----------------------------------------------------------------------------------------
+//! \class TaskProfiler
+//! \brief records the time spent in each task, per task name and stage.
+//!
+//! Enabled with <profiler>/tasks = true. Each OpenMP thread accumulates its own
+//! statistics and trace events, which are merged when Write() is called at the end of the
+//! run. Write() produces, on every rank, a text summary (including the critical path
+//! through the dependency graph of each task list) and a Chrome-trace JSON timeline that
+//! can be loaded in chrome://tracing or https://ui.perfetto.dev.
+
+class TaskProfiler {
+ public:
+  TaskProfiler(ParameterInput *pin, int nthreads);
+
+  int AddList(const std::string &name, const TaskGraph *pgraph, const int *slot);
+  int GetSlot(int list, const std::string &task_name);
+  void Record(int slot, int stage, int gid, double tstart, double tstop,
+              TaskStatus ret);
+  void Write();
+
+  static double Now();
+
+ private:
+  struct TaskTimes {
+    std::int64_t ncall, nfail;
+    double total, max, fail; // seconds
+  };
+  struct TraceEvent {
+    double tstart, duration;
+    int slot, stage, gid;
+  };
+  struct ThreadData {
+    std::vector<std::vector<TaskTimes>> times; // [slot][stage]
+    std::vector<TraceEvent> events;
+    std::int64_t ndropped;
+    char pad[CACHELINE_BYTES]; // avoid false sharing of the vector headers
+  };
+  struct ListInfo {
+    std::string name;
+    const TaskGraph *pgraph; // nullptr if the list is rebuilt during the run
+    const int *slot;         // slot of each task in the list
+  };
+
+  std::string basename_;
+  bool trace_;
+  std::int64_t max_events_;
+  double tbegin_;
+  std::vector<ListInfo> lists_;
+  std::vector<int> slot_list_;           // list of each slot
+  std::vector<std::string> slot_name_;   // task name of each slot
+  std::map<std::pair<int, std::string>, int> slot_map_;
+  std::vector<ThreadData> thread_;
+
+  void MergeThreads(std::vector<std::vector<TaskTimes>> &times);
+  void WriteSummary(const std::vector<std::vector<TaskTimes>> &times);
+  void WriteTrace();
+};
+
+#endif // TASK_LIST_TASK_PROFILER_HPP_
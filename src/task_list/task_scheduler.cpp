@@ -0,0 +1,170 @@
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file task_scheduler.cpp
+//! \brief implementation of the WorkQueue and TaskScheduler classes
+
+// C headers
+
+// C++ headers
+#include <deque>      // std::deque
+#include <vector>     // std::vector
+
+// Athena++ headers
+#include "task_scheduler.hpp"
+
+//----------------------------------------------------------------------------------------
+//! WorkQueue constructor
+
+WorkQueue::WorkQueue() {
+#ifdef OPENMP_PARALLEL
+  omp_init_lock(&lock_);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! WorkQueue destructor
+
+WorkQueue::~WorkQueue() {
+#ifdef OPENMP_PARALLEL
+  omp_destroy_lock(&lock_);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void WorkQueue::Lock()
+//! \brief Lock the queue for modification
+
+void WorkQueue::Lock() {
+#ifdef OPENMP_PARALLEL
+  omp_set_lock(&lock_);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void WorkQueue::Unlock()
+//! \brief Unlock the queue
+
+void WorkQueue::Unlock() {
+#ifdef OPENMP_PARALLEL
+  omp_unset_lock(&lock_);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void WorkQueue::Clear()
+//! \brief remove all items from the queue
+
+void WorkQueue::Clear() {
+  Lock();
+  items_.clear();
+  Unlock();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void WorkQueue::PushBack(int item)
+//! \brief append an item to the end of the queue
+
+void WorkQueue::PushBack(int item) {
+  Lock();
+  items_.push_back(item);
+  Unlock();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool WorkQueue::PopFront(int &item)
+//! \brief take the first item of the queue (owner side). Returns false if empty.
+
+bool WorkQueue::PopFront(int &item) {
+  bool found = false;
+  Lock();
+  if (!items_.empty()) {
+    item = items_.front();
+    items_.pop_front();
+    found = true;
+  }
+  Unlock();
+  return found;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool WorkQueue::StealBack(int &item)
+//! \brief take the last item of the queue (thief side). Returns false if empty.
+
+bool WorkQueue::StealBack(int &item) {
+  bool found = false;
+  Lock();
+  if (!items_.empty()) {
+    item = items_.back();
+    items_.pop_back();
+    found = true;
+  }
+  Unlock();
+  return found;
+}
+
+//----------------------------------------------------------------------------------------
+//! TaskScheduler destructor
+
+TaskScheduler::~TaskScheduler() {
+  delete [] queues_;
+  delete [] parked_;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskScheduler::Assign(int nthreads, int nitems)
+//! \brief (re)allocate the per-thread queues and distribute the items [0, nitems) in
+//! contiguous chunks, so that each thread starts on neighboring MeshBlocks
+
+void TaskScheduler::Assign(int nthreads, int nitems) {
+  if (nthreads != nthreads_) {
+    delete [] queues_;
+    delete [] parked_;
+    nthreads_ = nthreads;
+    queues_ = new WorkQueue[nthreads_];
+    parked_ = new std::vector<int>[nthreads_];
+  }
+  for (int t=0; t<nthreads_; ++t) {
+    queues_[t].Clear();
+    parked_[t].clear();
+  }
+  int nper = nitems/nthreads_, nrem = nitems%nthreads_;
+  int item = 0;
+  for (int t=0; t<nthreads_; ++t) {
+    int ncount = nper + ((t < nrem) ? 1 : 0);
+    for (int n=0; n<ncount; ++n)
+      queues_[t].PushBack(item++);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool TaskScheduler::GetWork(int tid, int &item)
+//! \brief get the next item from the queue of thread tid, or steal one from another
+//! thread. Returns false if no queue holds any work.
+
+bool TaskScheduler::GetWork(int tid, int &item) {
+  if (queues_[tid].PopFront(item)) return true;
+  for (int n=1; n<nthreads_; ++n) {
+    if (queues_[(tid+n)%nthreads_].StealBack(item)) return true;
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void TaskScheduler::RearmAll(int tid)
+//! \brief move all parked items of thread tid back to its queue
+
+void TaskScheduler::RearmAll(int tid) {
+  std::vector<int> &parked = parked_[tid];
+  for (auto it = parked.begin(); it != parked.end(); ++it)
+    queues_[tid].PushBack(*it);
+  parked.clear();
+  return;
+}
@@ -0,0 +1,81 @@
+#ifndef TASK_LIST_TASK_SCHEDULER_HPP_
+#define TASK_LIST_TASK_SCHEDULER_HPP_
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file task_scheduler.hpp
+//! \brief per-thread work queues used to schedule MeshBlocks in TaskList
+
+// C headers
+
+// C++ headers
+#include <deque>      // std::deque
+#include <vector>     // std::vector
+
+// Athena++ headers
+#include "../athena.hpp"
+
+// OpenMP header
+#ifdef OPENMP_PARALLEL
+#include <omp.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \class WorkQueue
+//! \brief double-ended queue of local MeshBlock indices owned by one OpenMP thread.
+//!
+//! The owner pushes and pops at the front, other threads steal from the back.
+
+class WorkQueue {
+ public:
+  WorkQueue();
+  ~WorkQueue();
+  WorkQueue(const WorkQueue&) = delete;
+  WorkQueue& operator=(const WorkQueue&) = delete;
+
+  void Clear();
+  void PushBack(int item);
+  bool PopFront(int &item);
+  bool StealBack(int &item);
+
+ private:
+  std::deque<int> items_;
+#ifdef OPENMP_PARALLEL
+  omp_lock_t lock_;
+#endif
+  void Lock();
+  void Unlock();
+};
+
+//----------------------------------------------------------------------------------------
+//! \class TaskScheduler
+//! \brief persistent work-stealing scheduler of MeshBlocks for TaskList
+//!
+//! Each thread owns a WorkQueue of blocks that can make progress and a private list of
+//! "parked" blocks that are stuck waiting for boundary data. A parked block is re-armed
+//! when a neighbor on the same rank notifies it (TaskStates::Notify), or when its owner
+//! runs out of work to do and needs to poll outstanding MPI receives.
+
+class TaskScheduler {
+ public:
+  TaskScheduler() : nthreads_(0), queues_(nullptr), parked_(nullptr) {}
+  ~TaskScheduler();
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+  void Assign(int nthreads, int nitems);
+  bool GetWork(int tid, int &item);
+  void Requeue(int tid, int item) { queues_[tid].PushBack(item); }
+  void Park(int tid, int item) { parked_[tid].push_back(item); }
+  std::vector<int>& Parked(int tid) { return parked_[tid]; }
+  void RearmAll(int tid);
+
+ private:
+  int nthreads_;
+  WorkQueue *queues_;
+  std::vector<int> *parked_;
+};
+
+#endif // TASK_LIST_TASK_SCHEDULER_HPP_
@@ -1097,6 +1097,8 @@ TimeIntegratorTaskList::TimeIntegratorTaskList(ParameterInput *pin, Mesh *pm) {
       AddTask(CLEAR_ALLBND,PHY_BVAL);
     }
   } // end of using namespace block
+  graph_.Compile(task_list_, ntasks);
+  InitProfiler(pm->ptprof, "TimeIntegratorTaskList");
 }
 
 //----------------------------------------------------------------------------------------
@@ -1123,251 +1125,301 @@ void TimeIntegratorTaskList::AddTask(const TaskID& id, const TaskID& dep) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ClearAllBoundary);
+    task_list_[ntasks].name = "ClearAllBoundary";
     task_list_[ntasks].lb_time = false;
   } else if (id == CALC_HYDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::CalculateHydroFlux);
+    task_list_[ntasks].name = "CalculateHydroFlux";
     task_list_[ntasks].lb_time = true;
   } else if (id == CALC_FLDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::CalculateEMF);
+    task_list_[ntasks].name = "CalculateEMF";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_HYDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydroFlux);
+    task_list_[ntasks].name = "SendHydroFlux";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_FLDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendEMF);
+    task_list_[ntasks].name = "SendEMF";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveAndCorrectHydroFlux);
+    task_list_[ntasks].name = "ReceiveAndCorrectHydroFlux";
     task_list_[ntasks].lb_time = false;
   } else if (id == RECV_FLDFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveAndCorrectEMF);
+    task_list_[ntasks].name = "ReceiveAndCorrectEMF";
     task_list_[ntasks].lb_time = false;
   } else if (id == INT_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::IntegrateHydro);
+    task_list_[ntasks].name = "IntegrateHydro";
     task_list_[ntasks].lb_time = true;
   } else if (id == INT_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::IntegrateField);
+    task_list_[ntasks].name = "IntegrateField";
     task_list_[ntasks].lb_time = true;
   } else if (id == SRCTERM_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::AddSourceTermsHydro);
+    task_list_[ntasks].name = "AddSourceTermsHydro";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydro);
+    task_list_[ntasks].name = "SendHydro";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendField);
+    task_list_[ntasks].name = "SendField";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveHydro);
+    task_list_[ntasks].name = "ReceiveHydro";
     task_list_[ntasks].lb_time = false;
   } else if (id == RECV_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveField);
+    task_list_[ntasks].name = "ReceiveField";
     task_list_[ntasks].lb_time = false;
   } else if (id == SETB_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SetBoundariesHydro);
+    task_list_[ntasks].name = "SetBoundariesHydro";
     task_list_[ntasks].lb_time = true;
   } else if (id == SETB_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SetBoundariesField);
+    task_list_[ntasks].name = "SetBoundariesField";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_HYDFLXSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydroFluxShear);
+    task_list_[ntasks].name = "SendHydroFluxShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYDFLXSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveHydroFluxShear);
+    task_list_[ntasks].name = "ReceiveHydroFluxShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == SEND_HYDSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydroShear);
+    task_list_[ntasks].name = "SendHydroShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYDSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveHydroShear);
+    task_list_[ntasks].name = "ReceiveHydroShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == SEND_FLDSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendFieldShear);
+    task_list_[ntasks].name = "SendFieldShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_FLDSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveFieldShear);
+    task_list_[ntasks].name = "ReceiveFieldShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == SEND_EMFSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendEMFShear);
+    task_list_[ntasks].name = "SendEMFShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_EMFSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveEMFShear);
+    task_list_[ntasks].name = "ReceiveEMFShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == PROLONG) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::Prolongation);
+    task_list_[ntasks].name = "Prolongation";
     task_list_[ntasks].lb_time = true;
   } else if (id == CONS2PRIM) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::Primitives);
+    task_list_[ntasks].name = "Primitives";
     task_list_[ntasks].lb_time = true;
   } else if (id == PHY_BVAL) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::PhysicalBoundary);
+    task_list_[ntasks].name = "PhysicalBoundary";
     task_list_[ntasks].lb_time = true;
   } else if (id == USERWORK) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::UserWork);
+    task_list_[ntasks].name = "UserWork";
     task_list_[ntasks].lb_time = true;
   } else if (id == NEW_DT) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::NewBlockTimeStep);
+    task_list_[ntasks].name = "NewBlockTimeStep";
     task_list_[ntasks].lb_time = true;
   } else if (id == FLAG_AMR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::CheckRefinement);
+    task_list_[ntasks].name = "CheckRefinement";
     task_list_[ntasks].lb_time = true;
   } else if (id == DIFFUSE_HYD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::DiffuseHydro);
+    task_list_[ntasks].name = "DiffuseHydro";
     task_list_[ntasks].lb_time = true;
   } else if (id == DIFFUSE_FLD) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::DiffuseField);
+    task_list_[ntasks].name = "DiffuseField";
     task_list_[ntasks].lb_time = true;
   } else if (id == CALC_SCLRFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::CalculateScalarFlux);
+    task_list_[ntasks].name = "CalculateScalarFlux";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_SCLRFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendScalarFlux);
+    task_list_[ntasks].name = "SendScalarFlux";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_SCLRFLX) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveScalarFlux);
+    task_list_[ntasks].name = "ReceiveScalarFlux";
     task_list_[ntasks].lb_time = false;
   } else if (id == INT_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::IntegrateScalars);
+    task_list_[ntasks].name = "IntegrateScalars";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendScalars);
+    task_list_[ntasks].name = "SendScalars";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveScalars);
+    task_list_[ntasks].name = "ReceiveScalars";
     task_list_[ntasks].lb_time = false;
   } else if (id == SETB_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SetBoundariesScalars);
+    task_list_[ntasks].name = "SetBoundariesScalars";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_SCLRSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendScalarsShear);
+    task_list_[ntasks].name = "SendScalarsShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_SCLRSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveScalarsShear);
+    task_list_[ntasks].name = "ReceiveScalarsShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == SEND_SCLRFLXSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendScalarsFluxShear);
+    task_list_[ntasks].name = "SendScalarsFluxShear";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_SCLRFLXSH) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveScalarsFluxShear);
+    task_list_[ntasks].name = "ReceiveScalarsFluxShear";
     task_list_[ntasks].lb_time = false;
   } else if (id == DIFFUSE_SCLR) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::DiffuseScalars);
+    task_list_[ntasks].name = "DiffuseScalars";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_HYDORB) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendHydroOrbital);
+    task_list_[ntasks].name = "SendHydroOrbital";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_HYDORB) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveHydroOrbital);
+    task_list_[ntasks].name = "ReceiveHydroOrbital";
     task_list_[ntasks].lb_time = false;
   } else if (id == CALC_HYDORB) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::CalculateHydroOrbital);
+    task_list_[ntasks].name = "CalculateHydroOrbital";
     task_list_[ntasks].lb_time = true;
   } else if (id == SEND_FLDORB) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::SendFieldOrbital);
+    task_list_[ntasks].name = "SendFieldOrbital";
     task_list_[ntasks].lb_time = true;
   } else if (id == RECV_FLDORB) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::ReceiveFieldOrbital);
+    task_list_[ntasks].name = "ReceiveFieldOrbital";
     task_list_[ntasks].lb_time = false;
   } else if (id == CALC_FLDORB) {
     task_list_[ntasks].TaskFunc=
         static_cast<TaskStatus (TaskList::*)(MeshBlock*,int)>
         (&TimeIntegratorTaskList::CalculateFieldOrbital);
+    task_list_[ntasks].name = "CalculateFieldOrbital";
     task_list_[ntasks].lb_time = true;
   } else {
     std::stringstream msg;
@@ -1569,25 +1621,23 @@ TaskStatus TimeIntegratorTaskList::IntegrateHydro(MeshBlock *pmb, int stage) {
 
   if (stage <= nstages) {
     if (stage_wghts[stage-1].main_stage) {
-      // This time-integrator-specific averaging operation logic is identical to FieldInt
-      Real ave_wghts[5];
-      ave_wghts[0] = 1.0;
-      ave_wghts[1] = stage_wghts[stage-1].delta;
-      ave_wghts[2] = 0.0;
-      ave_wghts[3] = 0.0;
-      ave_wghts[4] = 0.0;
-      pmb->WeightedAve(ph->u1, ph->u, ph->u2, ph->u0, ph->fl_div, ave_wghts);
+      // This time-integrator-specific averaging operation logic is identical to FieldInt.
+      // The averages of u1 and u and the flux divergence are done in a single pass
+      Real ave_wghts1[5], ave_wghts[5];
+      ave_wghts1[0] = 1.0;
+      ave_wghts1[1] = stage_wghts[stage-1].delta;
+      ave_wghts1[2] = 0.0;
+      ave_wghts1[3] = 0.0;
+      ave_wghts1[4] = 0.0;
 
       ave_wghts[0] = stage_wghts[stage-1].gamma_1;
       ave_wghts[1] = stage_wghts[stage-1].gamma_2;
       ave_wghts[2] = stage_wghts[stage-1].gamma_3;
-      if (ave_wghts[0] == 0.0 && ave_wghts[1] == 1.0 && ave_wghts[2] == 0.0)
-        ph->u.SwapAthenaArray(ph->u1);
-      else
-        pmb->WeightedAve(ph->u, ph->u1, ph->u2, ph->u0, ph->fl_div, ave_wghts);
+      ave_wghts[3] = 0.0;
+      ave_wghts[4] = 0.0;
 
       const Real wght = stage_wghts[stage-1].beta*pmb->pmy_mesh->dt;
-      ph->AddFluxDivergence(wght, ph->u);
+      ph->WeightedAveFluxDivergence(ave_wghts1, ave_wghts, wght);
       // add coordinate (geometric) source terms
       pmb->pcoord->AddCoordTermsDivergence(wght, ph->flux, ph->w, pf->bcc, ph->u);
 
@@ -1623,27 +1673,23 @@ TaskStatus TimeIntegratorTaskList::IntegrateField(MeshBlock *pmb, int stage) {
 
   if (stage <= nstages) {
     if (stage_wghts[stage-1].main_stage) {
-      // This time-integrator-specific averaging operation logic is identical to HydroInt
-      Real ave_wghts[5];
-      ave_wghts[0] = 1.0;
-      ave_wghts[1] = stage_wghts[stage-1].delta;
-      ave_wghts[2] = 0.0;
-      ave_wghts[3] = 0.0;
-      ave_wghts[4] = 0.0;
-      pmb->WeightedAve(pf->b1, pf->b, pf->b2, pf->b0, pf->ct_update, ave_wghts);
+      // This time-integrator-specific averaging operation logic is identical to HydroInt.
+      // The averages of b1 and b and the CT update are done in a single pass
+      Real ave_wghts1[5], ave_wghts[5];
+      ave_wghts1[0] = 1.0;
+      ave_wghts1[1] = stage_wghts[stage-1].delta;
+      ave_wghts1[2] = 0.0;
+      ave_wghts1[3] = 0.0;
+      ave_wghts1[4] = 0.0;
 
       ave_wghts[0] = stage_wghts[stage-1].gamma_1;
       ave_wghts[1] = stage_wghts[stage-1].gamma_2;
       ave_wghts[2] = stage_wghts[stage-1].gamma_3;
-      if (ave_wghts[0] == 0.0 && ave_wghts[1] == 1.0 && ave_wghts[2] == 0.0) {
-        pf->b.x1f.SwapAthenaArray(pf->b1.x1f);
-        pf->b.x2f.SwapAthenaArray(pf->b1.x2f);
-        pf->b.x3f.SwapAthenaArray(pf->b1.x3f);
-      } else {
-        pmb->WeightedAve(pf->b, pf->b1, pf->b2, pf->b0, pf->ct_update, ave_wghts);
-      }
+      ave_wghts[3] = 0.0;
+      ave_wghts[4] = 0.0;
 
-      pf->CT(stage_wghts[stage-1].beta*pmb->pmy_mesh->dt, pf->b);
+      const Real wght = stage_wghts[stage-1].beta*pmb->pmy_mesh->dt;
+      pf->WeightedAveCT(ave_wghts1, ave_wghts, wght);
     }
     return TaskStatus::next;
   }
@@ -2138,24 +2184,21 @@ TaskStatus TimeIntegratorTaskList::IntegrateScalars(MeshBlock *pmb, int stage) {
     if (stage_wghts[stage-1].main_stage) {
       // This time-integrator-specific averaging operation logic is identical to
       // IntegrateHydro, IntegrateField
-      Real ave_wghts[5];
-      ave_wghts[0] = 1.0;
-      ave_wghts[1] = stage_wghts[stage-1].delta;
-      ave_wghts[2] = 0.0;
-      ave_wghts[3] = 0.0;
-      ave_wghts[4] = 0.0;
-      pmb->WeightedAve(ps->s1, ps->s, ps->s2, ps->s0, ps->s_fl_div, ave_wghts);
+      Real ave_wghts1[5], ave_wghts[5];
+      ave_wghts1[0] = 1.0;
+      ave_wghts1[1] = stage_wghts[stage-1].delta;
+      ave_wghts1[2] = 0.0;
+      ave_wghts1[3] = 0.0;
+      ave_wghts1[4] = 0.0;
 
       ave_wghts[0] = stage_wghts[stage-1].gamma_1;
       ave_wghts[1] = stage_wghts[stage-1].gamma_2;
       ave_wghts[2] = stage_wghts[stage-1].gamma_3;
-      if (ave_wghts[0] == 0.0 && ave_wghts[1] == 1.0 && ave_wghts[2] == 0.0)
-        ps->s.SwapAthenaArray(ps->s1);
-      else
-        pmb->WeightedAve(ps->s, ps->s1, ps->s2, ps->s0, ps->s_fl_div, ave_wghts);
+      ave_wghts[3] = 0.0;
+      ave_wghts[4] = 0.0;
 
       const Real wght = stage_wghts[stage-1].beta*pmb->pmy_mesh->dt;
-      ps->AddFluxDivergence(wght, ps->s);
+      ps->WeightedAveFluxDivergence(ave_wghts1, ave_wghts, wght);
 
       // Hardcode an additional flux divergence weighted average for the penultimate
       // stage of SSPRK(5,4) since it cannot be expressed in a 3S* framework
@@ -0,0 +1,215 @@
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file compression.cpp
+//! \brief implementation of the BlockCompression codec
+
+// C headers
+
+// C++ headers
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t, std::uint64_t
+#include <cstring>   // std::memcpy
+#include <vector>    // std::vector
+
+// Athena++ headers
+#include "compression.hpp"
+
+namespace BlockCompression {
+namespace {
+const unsigned char kStored = 0, kShuffleLZ = 1;
+const std::size_t kMinMatch = 4;
+const std::size_t kLastLiterals = 8;  // the end of a chunk is always coded as literals
+const std::size_t kMaxOffset = 65535;
+const int kHashBits = 14;
+
+std::uint32_t Read32(const unsigned char *p) {
+  std::uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+std::uint32_t Hash(std::uint32_t v) {
+  return (v*2654435761U) >> (32 - kHashBits);
+}
+
+//! write a length in the LZ4 style: 255-valued bytes followed by the remainder
+unsigned char *PutLength(unsigned char *op, std::size_t len) {
+  for (; len >= 255; len -= 255) *op++ = 255;
+  *op++ = static_cast<unsigned char>(len);
+  return op;
+}
+
+//! read a length continuation, returning false if it runs past the end of the chunk
+bool GetLength(const unsigned char *&ip, const unsigned char *iend, std::size_t &len) {
+  unsigned char c;
+  do {
+    if (ip >= iend) return false;
+    c = *ip++;
+    len += c;
+  } while (c == 255);
+  return true;
+}
+
+//! append one sequence: literals [lit, lit+nlit) followed by a match (if mlen > 0)
+unsigned char *PutSequence(unsigned char *op, const unsigned char *lit, std::size_t nlit,
+                           std::size_t offset, std::size_t mlen) {
+  unsigned char *token = op++;
+  *token = static_cast<unsigned char>((nlit < 15 ? nlit : 15) << 4);
+  if (nlit >= 15) op = PutLength(op, nlit - 15);
+  std::memcpy(op, lit, nlit);
+  op += nlit;
+  if (mlen == 0) return op;
+  *op++ = static_cast<unsigned char>(offset & 0xff);
+  *op++ = static_cast<unsigned char>(offset >> 8);
+  std::size_t ml = mlen - kMinMatch;
+  *token = static_cast<unsigned char>(*token | (ml < 15 ? ml : 15));
+  if (ml >= 15) op = PutLength(op, ml - 15);
+  return op;
+}
+
+//! LZ77 compression of src into dst, which must hold MaxCompressedSize(n) bytes
+std::size_t CompressLZ(const unsigned char *src, std::size_t n, unsigned char *dst) {
+  std::vector<std::uint32_t> table(1 << kHashBits, 0);  // position+1 of the last hit
+  unsigned char *op = dst;
+  std::size_t ip = 0, anchor = 0;
+  if (n > kMinMatch + kLastLiterals) {
+    const std::size_t ilimit = n - kLastLiterals - kMinMatch;
+    while (ip <= ilimit) {
+      std::uint32_t seq = Read32(src + ip);
+      std::uint32_t h = Hash(seq);
+      std::size_t ref = table[h];
+      table[h] = static_cast<std::uint32_t>(ip + 1);
+      if (ref == 0 || ip + 1 - ref > kMaxOffset || Read32(src + ref - 1) != seq) {
+        // skip faster through data that does not match
+        ip += 1 + ((ip - anchor) >> 6);
+        continue;
+      }
+      ref--;
+      std::size_t mlen = kMinMatch;
+      while (ip + mlen < n - kLastLiterals && src[ref + mlen] == src[ip + mlen]) mlen++;
+      op = PutSequence(op, src + anchor, ip - anchor, ip - ref, mlen);
+      ip += mlen;
+      anchor = ip;
+    }
+  }
+  op = PutSequence(op, src + anchor, n - anchor, 0, 0);
+  return static_cast<std::size_t>(op - dst);
+}
+
+//! LZ77 decompression; returns false unless src decodes to exactly n bytes
+bool DecompressLZ(const unsigned char *src, std::size_t csize, unsigned char *dst,
+                  std::size_t n) {
+  const unsigned char *ip = src, *iend = src + csize;
+  unsigned char *op = dst, *oend = dst + n;
+  while (ip < iend) {
+    unsigned char token = *ip++;
+    std::size_t nlit = token >> 4;
+    if (nlit == 15 && !GetLength(ip, iend, nlit)) return false;
+    if (nlit > static_cast<std::size_t>(iend - ip)
+        || nlit > static_cast<std::size_t>(oend - op)) return false;
+    std::memcpy(op, ip, nlit);
+    ip += nlit;
+    op += nlit;
+    if (ip == iend) break;  // the last sequence has no match
+    if (iend - ip < 2) return false;
+    std::size_t offset = ip[0] | (static_cast<std::size_t>(ip[1]) << 8);
+    ip += 2;
+    std::size_t mlen = token & 15;
+    if (mlen == 15 && !GetLength(ip, iend, mlen)) return false;
+    mlen += kMinMatch;
+    if (offset == 0 || offset > static_cast<std::size_t>(op - dst)
+        || mlen > static_cast<std::size_t>(oend - op)) return false;
+    // byte by byte, since the match may overlap the output
+    const unsigned char *match = op - offset;
+    for (std::size_t i=0; i<mlen; ++i) op[i] = match[i];
+    op += mlen;
+  }
+  return op == oend;
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn std::size_t MaxCompressedSize(std::size_t n)
+//! \brief upper bound of the compressed size of n bytes
+
+std::size_t MaxCompressedSize(std::size_t n) {
+  return n + n/255 + 16;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn std::size_t Compress(const char *src, std::size_t n, int width, char *dst)
+//! \brief compress n bytes of words of width bytes into dst, which must hold
+//!        MaxCompressedSize(n) bytes. Returns the compressed size.
+
+std::size_t Compress(const char *src, std::size_t n, int width, char *dst) {
+  const unsigned char *in = reinterpret_cast<const unsigned char *>(src);
+  unsigned char *out = reinterpret_cast<unsigned char *>(dst);
+  std::vector<unsigned char> shuffled(n);
+  std::size_t nword = (width > 1) ? n/width : 0;
+  for (int b=0; b<width && nword > 0; ++b) {
+    unsigned char *ps = shuffled.data() + b*nword;
+    for (std::size_t i=0; i<nword; ++i)
+      ps[i] = in[i*width + b];
+  }
+  std::memcpy(shuffled.data() + nword*width, in + nword*width, n - nword*width);
+
+  std::size_t csize = CompressLZ(shuffled.data(), n, out + 1);
+  if (csize < n) {
+    out[0] = kShuffleLZ;
+    return csize + 1;
+  }
+  out[0] = kStored;
+  std::memcpy(out + 1, in, n);
+  return n + 1;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool Decompress(const char *src, std::size_t csize, int width, char *dst,
+//!                     std::size_t n)
+//! \brief decompress a chunk of csize bytes into the n bytes of dst. Returns false if
+//!        the chunk is corrupt or does not have the expected size.
+
+bool Decompress(const char *src, std::size_t csize, int width, char *dst,
+                std::size_t n) {
+  const unsigned char *in = reinterpret_cast<const unsigned char *>(src);
+  unsigned char *out = reinterpret_cast<unsigned char *>(dst);
+  if (csize < 1) return false;
+  if (in[0] == kStored) {
+    if (csize - 1 != n) return false;
+    std::memcpy(out, in + 1, n);
+    return true;
+  }
+  if (in[0] != kShuffleLZ) return false;
+  std::vector<unsigned char> shuffled(n);
+  if (!DecompressLZ(in + 1, csize - 1, shuffled.data(), n)) return false;
+  std::size_t nword = (width > 1) ? n/width : 0;
+  for (int b=0; b<width && nword > 0; ++b) {
+    const unsigned char *ps = shuffled.data() + b*nword;
+    for (std::size_t i=0; i<nword; ++i)
+      out[i*width + b] = ps[i];
+  }
+  std::memcpy(out + nword*width, shuffled.data() + nword*width, n - nword*width);
+  return true;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn std::uint64_t Checksum(const char *data, std::size_t n)
+//! \brief 64-bit FNV-1a hash of n bytes, taken over 8-byte words for speed
+
+std::uint64_t Checksum(const char *data, std::size_t n) {
+  const std::uint64_t prime = 0x100000001b3ULL;
+  std::uint64_t h = 0xcbf29ce484222325ULL;
+  std::size_t nword = n/sizeof(std::uint64_t);
+  for (std::size_t i=0; i<nword; ++i) {
+    std::uint64_t w;
+    std::memcpy(&w, data + i*sizeof(std::uint64_t), sizeof(w));
+    h = (h ^ w)*prime;
+  }
+  for (std::size_t i=nword*sizeof(std::uint64_t); i<n; ++i)
+    h = (h ^ static_cast<unsigned char>(data[i]))*prime;
+  return (h ^ n)*prime;
+}
+} // namespace BlockCompression
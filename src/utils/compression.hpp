@@ -0,0 +1,36 @@
+#ifndef UTILS_COMPRESSION_HPP_
+#define UTILS_COMPRESSION_HPP_
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file compression.hpp
+//! \brief prototypes of the lossless codec used for compressed restart files
+
+// C headers
+
+// C++ headers
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+
+// Athena++ headers
+
+//----------------------------------------------------------------------------------------
+//! \namespace BlockCompression
+//! \brief self-contained byte-shuffle + LZ77 codec for independent chunks of data
+//!
+//! The bytes of the width-byte words are first grouped by significance (byte shuffle),
+//! which turns the slowly varying sign/exponent bytes of floating-point data into long
+//! runs. The result is compressed with a greedy LZ77 coder using the LZ4 block sequence
+//! layout (token, literals, 16-bit offset, match length). A chunk that does not shrink
+//! is stored as is. Every chunk starts with a one-byte method tag.
+
+namespace BlockCompression {
+std::size_t MaxCompressedSize(std::size_t n);
+std::size_t Compress(const char *src, std::size_t n, int width, char *dst);
+bool Decompress(const char *src, std::size_t csize, int width, char *dst,
+                std::size_t n);
+std::uint64_t Checksum(const char *data, std::size_t n);
+} // namespace BlockCompression
+#endif // UTILS_COMPRESSION_HPP_
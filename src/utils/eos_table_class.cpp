@@ -161,4 +161,5 @@ EosTable::EosTable(ParameterInput *pin) :
         << "Options are 'ascii', 'binary', and 'hdf5'." << std::endl;
     ATHENA_ERROR(msg);
   }
+  table.PairRows();
 }
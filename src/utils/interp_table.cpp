@@ -95,3 +95,46 @@ Real InterpTable2D::interpolate(int var, Real x2, Real x1) {
           + (1-xrl)*(1-yrl)*data(var,xil+1,yil+1);
   return out;
 }
+
+//! Copy data into a layout in which each entry is followed by its neighbor in x2, so that
+//! the four points used by the bilinear interpolation of a table cell are contiguous in
+//! memory. Must be called after the table data is set and before the batched
+//! interpolate() is used.
+void InterpTable2D::PairRows() {
+  paired_.NewAthenaArray(nvar_, nx2_-1, nx1_, 2);
+  for (int var=0; var<nvar_; ++var) {
+    for (int x=0; x<nx2_-1; ++x) {
+      for (int y=0; y<nx1_; ++y) {
+        paired_(var,x,y,0) = data(var, x ,y);
+        paired_(var,x,y,1) = data(var,x+1,y);
+      }
+    }
+  }
+}
+
+//! Bilinear interpolation of n points, out[m] = interpolate(var, x2[m], x1[m]), using
+//! the paired-row layout built by PairRows()
+void InterpTable2D::interpolate(int var, const int n, const Real *x2, const Real *x1,
+                                Real *out) {
+  const int nx = nx2_;
+  const int ny = nx1_;
+  for (int m=0; m<n; ++m) {
+    Real x = (x2[m] - x2min_) * x2norm_;
+    Real y = (x1[m] - x1min_) * x1norm_;
+    int xil = static_cast<int>(x); // lower x index
+    int yil = static_cast<int>(y); // lower y index
+    // if off table, do linear extrapolation
+    xil = (xil < 0) ? 0 : xil;
+    xil = (xil > nx - 2) ? nx - 2 : xil;
+    yil = (yil < 0) ? 0 : yil;
+    yil = (yil > ny - 2) ? ny - 2 : yil;
+    Real xrl = 1 + xil - x;  // x residual
+    Real yrl = 1 + yil - y;  // y residual
+    // the 4 nearest data points: (xil,yil), (xil+1,yil), (xil,yil+1), (xil+1,yil+1)
+    const Real *q = &paired_(var,xil,yil,0);
+    out[m] =   xrl  *  yrl  *q[0]
+               +   xrl  *(1-yrl)*q[2]
+               + (1-xrl)*  yrl  *q[1]
+               + (1-xrl)*(1-yrl)*q[3];
+  }
+}
@@ -24,6 +24,8 @@ class InterpTable2D {
 
   void SetSize(const int nvar, const int nx2, const int nx1);
   Real interpolate(int nvar, Real x2, Real x1);
+  void interpolate(int nvar, const int n, const Real *x2, const Real *x1, Real *out);
+  void PairRows();
   int nvar();
   AthenaArray<Real> data;
   void SetX1lim(Real x1min, Real x1max);
@@ -42,6 +44,7 @@ class InterpTable2D {
   Real x2min_;
   Real x2max_;
   Real x2norm_;
+  AthenaArray<Real> paired_;  // data(nvar, x2+{0,1}, x1) interleaved, see PairRows()
 };
 
 class EosTable {
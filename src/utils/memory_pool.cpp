@@ -0,0 +1,199 @@
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file memory_pool.cpp
+//! \brief implementation of the MemoryPool allocator
+
+// C headers
+
+// C++ headers
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t, std::uintptr_t
+#include <cstdlib>    // std::malloc, std::free
+#include <cstring>    // std::memcpy, std::memset
+#include <iomanip>    // std::setprecision
+#include <iostream>   // std::cout
+#include <new>        // std::bad_alloc
+#include <vector>     // std::vector
+
+// Athena++ headers
+#include "../athena.hpp"
+#include "../globals.hpp"
+#include "memory_pool.hpp"
+
+// MPI header
+#ifdef MPI_PARALLEL
+#include <mpi.h>
+#endif
+
+namespace MemoryPool {
+namespace {
+const int kSubClasses = 8;          // size classes per power of two
+const int kMinShift = 6;            // the smallest class holds 64 bytes
+const int kNumClasses = 1 + kSubClasses*(64 - kMinShift);
+
+//! stored in front of every chunk
+struct ChunkHeader {
+  void *raw;                        // address returned by std::malloc
+  int size_class;
+};
+
+static_assert(alignment == CACHELINE_BYTES, "MemoryPool::alignment != CACHELINE_BYTES");
+
+bool enabled = false;
+std::vector<void *> free_list[kNumClasses];
+// statistics
+std::uint64_t nrequest = 0, nreuse = 0;
+std::uint64_t bytes_requested = 0, bytes_served = 0;
+std::size_t bytes_in_use = 0, bytes_peak = 0, bytes_reserved = 0;
+
+int SizeClass(std::size_t nbytes) {
+  if (nbytes <= (1U << kMinShift)) return 0;
+  int k = kMinShift;
+  while ((static_cast<std::size_t>(2) << k) < nbytes) k++;  // 2^k < nbytes <= 2^(k+1)
+  std::size_t step = static_cast<std::size_t>(1) << (k - 3);
+  std::size_t j = (nbytes - (static_cast<std::size_t>(1) << k) + step - 1)/step;
+  return 1 + kSubClasses*(k - kMinShift) + static_cast<int>(j) - 1;
+}
+
+std::size_t ClassSize(int c) {
+  if (c == 0) return static_cast<std::size_t>(1) << kMinShift;
+  int k = kMinShift + (c - 1)/kSubClasses;
+  std::size_t j = (c - 1)%kSubClasses + 1;
+  return (static_cast<std::size_t>(1) << k) + j*(static_cast<std::size_t>(1) << (k - 3));
+}
+
+//! a new chunk of class c from the system, aligned to CACHELINE_BYTES
+void *NewChunk(int c) {
+  char *raw = static_cast<char *>(std::malloc(ClassSize(c) + sizeof(ChunkHeader)
+                                              + CACHELINE_BYTES));
+  if (raw == nullptr) throw std::bad_alloc();
+  std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(raw) + sizeof(ChunkHeader);
+  addr = (addr + CACHELINE_BYTES - 1) & ~static_cast<std::uintptr_t>(CACHELINE_BYTES - 1);
+  char *p = reinterpret_cast<char *>(addr);
+  ChunkHeader h{raw, c};
+  std::memcpy(p - sizeof(ChunkHeader), &h, sizeof(ChunkHeader));
+  bytes_reserved += ClassSize(c);
+  return p;
+}
+
+ChunkHeader GetHeader(void *p) {
+  ChunkHeader h;
+  std::memcpy(&h, static_cast<char *>(p) - sizeof(ChunkHeader), sizeof(ChunkHeader));
+  return h;
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn void Enable()
+//! \brief start serving AthenaArray allocations from the pool. Arrays allocated before
+//!        keep their memory from new[].
+
+void Enable() {
+  enabled = true;
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool IsEnabled()
+//! \brief true if AthenaArray allocations are served from the pool
+
+bool IsEnabled() {
+  return enabled;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void *Allocate(std::size_t nbytes)
+//! \brief zero-initialized, cache-line aligned memory of at least nbytes
+
+void *Allocate(std::size_t nbytes) {
+  int c = SizeClass(nbytes);
+  void *p = nullptr;
+#pragma omp critical (memory_pool)
+  {
+    nrequest++;
+    bytes_requested += nbytes;
+    bytes_served += ClassSize(c);
+    if (!free_list[c].empty()) {
+      p = free_list[c].back();
+      free_list[c].pop_back();
+      nreuse++;
+    } else {
+      p = NewChunk(c);
+    }
+    bytes_in_use += ClassSize(c);
+    if (bytes_in_use > bytes_peak) bytes_peak = bytes_in_use;
+  }
+  std::memset(p, 0, nbytes);
+  return p;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Free(void *p)
+//! \brief return memory obtained from Allocate() to the free list of its size class
+
+void Free(void *p) {
+  if (p == nullptr) return;
+  int c = GetHeader(p).size_class;
+#pragma omp critical (memory_pool)
+  {
+    free_list[c].push_back(p);
+    bytes_in_use -= ClassSize(c);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ReleaseCache()
+//! \brief give the memory on the free lists back to the system
+
+void ReleaseCache() {
+#pragma omp critical (memory_pool)
+  {
+    for (int c=0; c<kNumClasses; ++c) {
+      for (void *p : free_list[c]) {
+        std::free(GetHeader(p).raw);
+        bytes_reserved -= ClassSize(c);
+      }
+      free_list[c].clear();
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OutputStatistics()
+//! \brief print the allocation statistics summed (counts) or maximized (bytes) over all
+//!        ranks. Must be called by all ranks.
+
+void OutputStatistics() {
+  std::uint64_t count[4] = {nrequest, nreuse, bytes_requested, bytes_served};
+  double mbytes[2] = {bytes_peak/1048576.0, bytes_reserved/1048576.0};
+#ifdef MPI_PARALLEL
+  if (Globals::my_rank == 0) {
+    MPI_Reduce(MPI_IN_PLACE, count, 4, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(MPI_IN_PLACE, mbytes, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  } else {
+    MPI_Reduce(count, nullptr, 4, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(mbytes, nullptr, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  }
+#endif
+  if (Globals::my_rank != 0) return;
+  std::ios_base::fmtflags flags = std::cout.flags();
+  std::streamsize precision = std::cout.precision();
+  std::cout << std::endl << "Memory pool: " << count[0] << " allocations, "
+            << std::fixed << std::setprecision(1)
+            << (count[0] > 0 ? 100.0*count[1]/count[0] : 0.0)
+            << "% reused freed memory" << std::endl
+            << "  per rank (max): peak in use = " << std::setprecision(2) << mbytes[0]
+            << " MiB, reserved = " << mbytes[1] << " MiB" << std::endl
+            << "  size-class rounding overhead = " << std::setprecision(1)
+            << (count[2] > 0 ? 100.0*(count[3] - count[2])/count[2] : 0.0) << "%"
+            << std::endl;
+  std::cout.flags(flags);
+  std::cout.precision(precision);
+  return;
+}
+} // namespace MemoryPool
@@ -0,0 +1,40 @@
+#ifndef UTILS_MEMORY_POOL_HPP_
+#define UTILS_MEMORY_POOL_HPP_
+//========================================================================================
+// Athena++ astrophysical MHD code
+// Copyright(C) 2014 James M. Stone <jmstone@princeton.edu> and other code contributors
+// Licensed under the 3-clause BSD License, see LICENSE file for details
+//========================================================================================
+//! \file memory_pool.hpp
+//! \brief prototypes of the optional pool allocator used by AthenaArray
+
+// C headers
+
+// C++ headers
+#include <cstddef>   // std::size_t
+
+// Athena++ headers
+
+//----------------------------------------------------------------------------------------
+//! \namespace MemoryPool
+//! \brief size-class pool from which AthenaArray draws its data when enabled with
+//! <mesh>/memory_pool = true
+//!
+//! Requests are rounded up to one of eight size classes per power of two and served from
+//! a free list of that class, so that the memory of the MeshBlocks destroyed by
+//! derefinement or load balancing is reused by the MeshBlocks created afterwards instead
+//! of going back to the system. Every allocation is aligned to CACHELINE_BYTES and
+//! zero-initialized. All functions are thread-safe.
+//!
+//! AthenaArray::NewPaddedAthenaArray() always uses the pool for its alignment.
+
+namespace MemoryPool {
+const std::size_t alignment = 64;  // bytes, equal to CACHELINE_BYTES
+void Enable();
+bool IsEnabled();
+void *Allocate(std::size_t nbytes);
+void Free(void *p);
+void ReleaseCache();
+void OutputStatistics();
+} // namespace MemoryPool
+#endif // UTILS_MEMORY_POOL_HPP_